@@ -176,6 +176,7 @@ Command::Command()
     addAvailableOption("warning", Option(Option::Number, "w", "Sketch", "Probability threshold for warning about low k-mer size.", "0.01", 0, 1));
     addAvailableOption("reads", Option(Option::Boolean, "r", "Sketch", "Input is a read set. See Reads options below. Incompatible with -i.", ""));
     addAvailableOption("seed", Option(Option::Integer, "S", "Sketch", "Seed to provide to the hash function.", "42", 0, 0xFFFFFFFF));
+    addAvailableOption("rolling", Option(Option::Boolean, "R", "Sketch", "Hash k-mers with ntHash, a rolling hash that is faster for DNA, rather than MurmurHash3. Sketches can only be compared to others made with the same hash function. Incompatible with -a and -z.", ""));
     addAvailableOption("memory", Option(Option::Size, "b", "Reads", "Use a Bloom filter of this size (raw bytes or with K/M/G/T) to filter out unique k-mers. This is useful if exact filtering with -m uses too much memory. However, some unique k-mers may pass erroneously, and copies cannot be counted beyond 2. Implies -r."));
     addAvailableOption("minCov", Option(Option::Integer, "m", "Reads", "Minimum copies of each k-mer required to pass noise filter for reads. Implies -r.", "1"));
     addAvailableOption("targetCov", Option(Option::Number, "c", "Reads", "Target coverage. Sketching will conclude if this coverage is reached before the end of the input file (estimated by average k-mer multiplicity). Implies -r."));
@@ -189,10 +190,13 @@ Command::Command()
     addAvailableOption("illumina", Option(Option::Boolean, "illumina", "", "Use default settings for Illumina sequences.", ""));
     addAvailableOption("nanopore", Option(Option::Boolean, "nanopore", "", "Use default settings for Oxford Nanopore sequences.", ""));
     addAvailableOption("factor", Option(Option::Number, "f", "Window", "Compression factor", "100"));
+    addAvailableOption("cascade", Option(Option::Integer, "cascade", "Cascade", "Screen pairs on the first this many hashes of their sketches before comparing whole sketches. Pairs that the prefixes show are beyond the maximum distance (-d), with the probability given by -cascadeProb, are dropped. Requires -d.", "", 1, 1000000000));
+    addAvailableOption("cascadeProb", Option(Option::Number, "cascadeProb", "Cascade", "Probability that a dropped pair is beyond the maximum distance, based on the binomial error model of the distance estimates (see \"mash bounds\").", "0.999", 0, 1));
     
     addCategory("", "");
     addCategory("Input", "Input");
     addCategory("Output", "Output");
+    addCategory("Cascade", "Cascade screening");
     addCategory("Sketch", "Sketching");
     addCategory("Window", "Sketching (windowed)");
     addCategory("Reads", "Sketching (reads)");
@@ -367,6 +371,7 @@ void Command::useSketchOptions()
     useOption("sketchSize");
     useOption("individual");
     useOption("seed");
+    useOption("rolling");
     useOption("warning");
     useOption("reads");
     useOption("memory");
@@ -6,10 +6,13 @@
 
 #include "CommandContain.h"
 #include "Sketch.h"
+#include "SketchManifest.h"
 #include <iostream>
 #include <zlib.h>
 #include "ThreadPool.h"
 #include "sketchParameterSetup.h"
+#include "cpuDispatch.h"
+#include <algorithm>
 #include <math.h>
 
 using namespace::std;
@@ -50,11 +53,13 @@ int CommandContain::run() const
     	return 1;
     }
     
+    parameters.mapped = true;
+    
     Sketch sketchRef;
     
     const string & fileReference = arguments[0];
     
-    bool isSketch = hasSuffix(fileReference, suffixSketch);
+    bool isSketch = hasSuffix(fileReference, suffixSketch) || isManifest(fileReference);
     
     if ( isSketch )
     {
@@ -99,6 +104,7 @@ int CommandContain::run() const
         parameters.noncanonical = sketchRef.getNoncanonical();
         parameters.preserveCase = sketchRef.getPreserveCase();
         parameters.seed = sketchRef.getHashSeed();
+        parameters.hashFunction = sketchRef.getHashFunction();
         
         string alphabet;
         sketchRef.getAlphabetAsString(alphabet);
@@ -228,38 +234,34 @@ CommandContain::ContainOutput * contain(CommandContain::ContainInput * input)
     return output;
 }
 
-double containSketches(const HashList & hashesSortedRef, const HashList & hashesSortedQuery, double & errorToSet)
+template <typename T>
+double containSketches(const T * hashesSortedRef, int sizeRef, const T * hashesSortedQuery, int sizeQuery, uint64_t (* countCommon)(const T *, uint64_t, const T *, uint64_t), double & errorToSet)
 {
-    int common = 0;
-    int denom = hashesSortedRef.size() < hashesSortedQuery.size() ?
-        hashesSortedRef.size() :
-        hashesSortedQuery.size();
+    // the query's hashes are compared, up to the smaller sketch size, as far
+    // as the last reference hash
     
-    int i = 0;
-    int j = 0;
+    int denom = sizeRef < sizeQuery ?
+        sizeRef :
+        sizeQuery;
     
-    for ( int steps = 0; steps < denom && i < hashesSortedRef.size(); steps++ )
-    {
-        if ( hashLessThan(hashesSortedRef.at(i), hashesSortedQuery.at(j), hashesSortedRef.get64()) )
-        {
-            i++;
-            steps--;
-        }
-        else if ( hashLessThan(hashesSortedQuery.at(j), hashesSortedRef.at(i), hashesSortedRef.get64()) )
-        {
-            j++;
-        }
-        else
-        {
-            i++;
-            j++;
-            common++;
-        }
-    }
+    int steps = sizeRef == 0 ? 0 : upper_bound(hashesSortedQuery, hashesSortedQuery + denom, hashesSortedRef[sizeRef - 1]) - hashesSortedQuery;
+    uint64_t common = countCommon(hashesSortedRef, sizeRef, hashesSortedQuery, steps);
     
-    errorToSet = 1. / sqrt(j);
+    errorToSet = 1. / sqrt(steps);
     
-    return double(common) / j;
+    return double(common) / steps;
+}
+
+double containSketches(const HashList & hashesSortedRef, const HashList & hashesSortedQuery, double & errorToSet)
+{
+    if ( hashesSortedRef.get64() )
+    {
+        return containSketches(hashesSortedRef.data<hash64_t>(), hashesSortedRef.size(), hashesSortedQuery.data<hash64_t>(), hashesSortedQuery.size(), getCpuKernels().countCommon64, errorToSet);
+    }
+    else
+    {
+        return containSketches(hashesSortedRef.data<hash32_t>(), hashesSortedRef.size(), hashesSortedQuery.data<hash32_t>(), hashesSortedQuery.size(), getCpuKernels().countCommon32, errorToSet);
+    }
 }
 
 } // namespace mash
@@ -6,11 +6,15 @@
 
 #include "CommandDistance.h"
 #include "Sketch.h"
+#include "SketchManifest.h"
 #include <iostream>
 #include <zlib.h>
 #include "ThreadPool.h"
 #include "sketchParameterSetup.h"
+#include "cpuDispatch.h"
+#include <algorithm>
 #include <math.h>
+#include <unistd.h>
 
 #ifdef USE_BOOST
     #include <boost/math/distributions/binomial.hpp>
@@ -38,6 +42,10 @@ CommandDistance::CommandDistance()
     addOption("pvalue", Option(Option::Number, "v", "Output", "Maximum p-value to report.", "1.0", 0., 1.));
     addOption("distance", Option(Option::Number, "d", "Output", "Maximum distance to report.", "1.0", 0., 1.));
     addOption("comment", Option(Option::Boolean, "C", "Output", "Show comment fields with reference/query names (denoted with ':').", "1.0", 0., 1.));
+    addOption("best", Option(Option::Integer, "best", "Output", "Report only this many of the closest references (that pass -d and -v) for each query, sorted by distance. Once this many are found, further references are only compared as far as needed to tell whether they are closer. Incompatible with -t.", "", 1, 1000000000));
+    useOption("cascade");
+    useOption("cascadeProb");
+    addOption("index", Option(Option::Boolean, "x", "Input", "Use an inverted index of the reference sketch to compare each query only to references that share hashes with it. The index is saved as <reference>" + string(suffixIndex) + " and rebuilt if missing or out of date. The reference must be a sketch file (" + suffixSketch + ").", ""));
     useSketchOptions();
 }
 
@@ -53,10 +61,18 @@ int CommandDistance::run() const
     bool list = options.at("list").active;
     bool table = options.at("table").active;
     bool comment = options.at("comment").active;
+    bool index = options.at("index").active;
+    uint64_t best = options.at("best").active ? options.at("best").getArgumentAsNumber() : 0;
     //bool log = options.at("log").active;
     double pValueMax = options.at("pvalue").getArgumentAsNumber();
     double distanceMax = options.at("distance").getArgumentAsNumber();
     
+    if ( table && best )
+    {
+        cerr << "ERROR: The options -" << options.at("table").identifier << " and -" << options.at("best").identifier << " cannot be used together." << endl;
+        return 1;
+    }
+    
     Sketch::Parameters parameters;
     
     if ( sketchParameterSetup(parameters, *(Command *)this) )
@@ -64,6 +80,8 @@ int CommandDistance::run() const
     	return 1;
     }
     
+    parameters.mapped = true;
+    
     Sketch sketchRef;
     
     uint64_t lengthMax;
@@ -74,7 +92,13 @@ int CommandDistance::run() const
     
     const string & fileReference = arguments[0];
     
-    bool isSketch = hasSuffix(fileReference, suffixSketch);
+    bool isSketch = hasSuffix(fileReference, suffixSketch) || isManifest(fileReference);
+    
+    if ( index && ! hasSuffix(fileReference, suffixSketch) )
+    {
+        cerr << "ERROR: The option -" << options.at("index").identifier << " requires the reference to be a sketch file (" << suffixSketch << ")." << endl;
+        return 1;
+    }
     
     if ( isSketch )
     {
@@ -132,6 +156,7 @@ int CommandDistance::run() const
         parameters.noncanonical = sketchRef.getNoncanonical();
         parameters.preserveCase = sketchRef.getPreserveCase();
         parameters.seed = sketchRef.getHashSeed();
+        parameters.hashFunction = sketchRef.getHashFunction();
         
         string alphabet;
         sketchRef.getAlphabetAsString(alphabet);
@@ -160,6 +185,38 @@ int CommandDistance::run() const
         cerr << "done.\n";
     }
     
+    CascadeScreen cascade;
+    
+    if ( options.at("cascade").active )
+    {
+        if ( distanceMax >= 1 )
+        {
+            cerr << "ERROR: The option -" << options.at("cascade").identifier << " requires a maximum distance (-" << options.at("distance").identifier << ") below 1." << endl;
+            return 1;
+        }
+        
+        setCascadeScreen(cascade, options.at("cascade").getArgumentAsNumber(), distanceMax, sketchRef.getKmerSize(), options.at("cascadeProb").getArgumentAsNumber());
+    }
+    
+    SketchIndex sketchIndex;
+    
+    if ( index )
+    {
+        string fileIndex = fileReference + suffixIndex;
+        
+        if ( ! sketchIndex.read(fileIndex, fileReference, sketchRef.getReferenceCount()) )
+        {
+            cerr << "Indexing " << fileReference << "...";
+            sketchIndex.build(sketchRef, fileReference);
+            cerr << "done.\n";
+            
+            if ( ! sketchIndex.write(fileIndex) )
+            {
+                cerr << "WARNING: Could not save the index to " << fileIndex << "." << endl;
+            }
+        }
+    }
+    
     if ( table )
     {
         cout << "#query";
@@ -192,48 +249,97 @@ int CommandDistance::run() const
     
     sketchQuery.initFromFiles(queryFiles, parameters, 0, true);
     
-    uint64_t pairCount = sketchRef.getReferenceCount() * sketchQuery.getReferenceCount();
-    uint64_t pairsPerThread = pairCount / parameters.parallelism;
+    // Square tiles of references by queries, sized so the sketches of a tile
+    // stay in L2 while each is compared to the others. Output is by query, so
+    // the tiles of a band of queries are held until the band is finished;
+    // bands are kept to maxBandPairs.
+    
+    static const uint64_t tileCacheBytes = 1 << 18;
+    static const uint64_t maxBandPairs = 1 << 20;
+    
+    uint64_t referenceCount = sketchRef.getReferenceCount();
+    uint64_t queryCount = sketchQuery.getReferenceCount();
+    uint64_t cacheBytes = tileCacheBytes;
+
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    if ( sysconf(_SC_LEVEL2_CACHE_SIZE) > 0 )
+    {
+        cacheBytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    }
+#endif
+    
+    uint64_t sketchBytes = parameters.minHashesPerWindow * (sketchRef.getUse64() ? sizeof(hash64_t) : sizeof(hash32_t));
+    uint64_t tileSide = cacheBytes / 2 / sketchBytes / 2;
+    
+    uint64_t tileQueries = min(tileSide, maxBandPairs / max(referenceCount, uint64_t(1)));
+    
+    if ( tileQueries == 0 )
+    {
+        tileQueries = 1;
+    }
+    
+    uint64_t tileRefs = tileSide * 2 > tileQueries ? tileSide * 2 - tileQueries : 1;
     
-    if ( pairsPerThread == 0 )
+    // small jobs still get a tile for each thread
+    
+    uint64_t pairsPerThread = (referenceCount * queryCount + parameters.parallelism - 1) / parameters.parallelism;
+    
+    if ( tileRefs * tileQueries > pairsPerThread )
     {
-    	pairsPerThread = 1;
+        tileRefs = max(pairsPerThread / tileQueries, uint64_t(1));
     }
     
-    static uint64_t maxPairsPerThread = 0x1000;
+    if ( index )
+    {
+        // whole bands, so each query gathers its candidates once
+        
+        tileRefs = referenceCount;
+    }
+    
+    if ( tileRefs > referenceCount )
+    {
+        tileRefs = max(referenceCount, uint64_t(1));
+    }
     
-    if ( pairsPerThread > maxPairsPerThread )
+    if ( tileQueries > queryCount )
     {
-        pairsPerThread = maxPairsPerThread;
+        tileQueries = queryCount;
     }
     
-    uint64_t iFloor = pairsPerThread / sketchRef.getReferenceCount();
-    uint64_t iMod = pairsPerThread % sketchRef.getReferenceCount();
+    vector<CompareOutput *> band;
+    uint64_t tilesPerBand = (referenceCount + tileRefs - 1) / tileRefs;
     
-    for ( uint64_t i = 0, j = 0; i < sketchQuery.getReferenceCount(); i += iFloor, j += iMod )
+    for ( uint64_t i = 0; i < queryCount; i += tileQueries )
     {
-        if ( j >= sketchRef.getReferenceCount() )
+        for ( uint64_t j = 0; j < referenceCount; j += tileRefs )
         {
-            if ( i == sketchQuery.getReferenceCount() - 1 )
+            uint64_t refs = min(tileRefs, referenceCount - j);
+            uint64_t queries = min(tileQueries, queryCount - i);
+            
+            threadPool.runWhenThreadAvailable(new CompareInput(sketchRef, sketchQuery, j, i, refs, queries, parameters, distanceMax, pValueMax, best, index ? &sketchIndex : 0, options.at("cascade").active ? &cascade : 0));
+            
+            while ( threadPool.outputAvailable() )
             {
-                break;
+                band.push_back(threadPool.popOutputWhenAvailable());
+                
+                if ( band.size() == tilesPerBand )
+                {
+                    writeOutput(band, table, comment, best);
+                    band.clear();
+                }
             }
-            
-            i++;
-            j -= sketchRef.getReferenceCount();
-        }
-        
-        threadPool.runWhenThreadAvailable(new CompareInput(sketchRef, sketchQuery, j, i, pairsPerThread, parameters, distanceMax, pValueMax));
-        
-        while ( threadPool.outputAvailable() )
-        {
-            writeOutput(threadPool.popOutputWhenAvailable(), table, comment);
         }
     }
     
     while ( threadPool.running() )
     {
-        writeOutput(threadPool.popOutputWhenAvailable(), table, comment);
+        band.push_back(threadPool.popOutputWhenAvailable());
+        
+        if ( band.size() == tilesPerBand )
+        {
+            writeOutput(band, table, comment, best);
+            band.clear();
+        }
     }
     
     if ( warningCount > 0 && ! parameters.reads )
@@ -244,63 +350,118 @@ int CommandDistance::run() const
     return 0;
 }
 
-void CommandDistance::writeOutput(CompareOutput * output, bool table, bool comment) const
+void CommandDistance::writeOutput(const vector<CompareOutput *> & band, bool table, bool comment, uint64_t best) const
 {
-    uint64_t i = output->indexQuery;
-    uint64_t j = output->indexRef;
+    const Sketch & sketchRef = band[0]->sketchRef;
+    const Sketch & sketchQuery = band[0]->sketchQuery;
     
-    for ( uint64_t k = 0; k < output->pairCount && i < output->sketchQuery.getReferenceCount(); k++ )
+    for ( uint64_t i = 0; i < band[0]->queryCount; i++ )
     {
-        const CompareOutput::PairOutput * pair = &output->pairs[k];
-        
-        if ( table && j == 0 )
-        {
-            cout << output->sketchQuery.getReference(i).name;
-        }
+        const Sketch::Reference & refQry = sketchQuery.getReference(band[0]->indexQuery + i);
         
-        if ( table )
-        {
-            cout << '\t';
-    
-            if ( pair->pass )
-            {
-                cout << pair->distance;
-            }
-        }
-        else if ( pair->pass )
+        if ( best )
         {
-            cout << output->sketchRef.getReference(j).name;
+            // each tile kept its closest; keep the closest of those
             
-            if ( comment )
+            vector<BestPair> pairs;
+            
+            for ( uint64_t tile = 0; tile < band.size(); tile++ )
             {
-                cout << ':' << output->sketchRef.getReference(j).comment;
+                const CompareOutput * output = band[tile];
+                
+                for ( uint64_t j = 0; j < output->refCount; j++ )
+                {
+                    CompareOutput::PairOutput * pair = &output->pairs[i * output->refCount + j];
+                    
+                    if ( pair->pass )
+                    {
+                        pairs.push_back(BestPair(pair->distance, output->indexRef + j, pair));
+                    }
+                }
             }
             
-            cout << '\t' << output->sketchQuery.getReference(i).name;
+            sort(pairs.begin(), pairs.end());
             
-            if ( comment )
+            for ( uint64_t k = 0; k < pairs.size() && k < best; k++ )
             {
-                cout << ':' << output->sketchQuery.getReference(i).comment;
+                const Sketch::Reference & refRef = sketchRef.getReference(pairs[k].index);
+                const CompareOutput::PairOutput * pair = pairs[k].pair;
+                
+                cout << refRef.name;
+                
+                if ( comment )
+                {
+                    cout << ':' << refRef.comment;
+                }
+                
+                cout << '\t' << refQry.name;
+                
+                if ( comment )
+                {
+                    cout << ':' << refQry.comment;
+                }
+                
+                cout << '\t' << pair->distance << '\t' << pair->pValue << '\t' << pair->numer << '/' << pair->denom << endl;
             }
             
-            cout << '\t' << pair->distance << '\t' << pair->pValue << '\t' << pair->numer << '/' << pair->denom << endl;
+            continue;
+        }
+        
+        if ( table )
+        {
+            cout << refQry.name;
         }
-    
-        j++;
         
-        if ( j == output->sketchRef.getReferenceCount() )
+        for ( uint64_t tile = 0; tile < band.size(); tile++ )
         {
-            if ( table )
+            const CompareOutput * output = band[tile];
+            
+            for ( uint64_t j = 0; j < output->refCount; j++ )
             {
-                cout << endl;
+                const CompareOutput::PairOutput * pair = &output->pairs[i * output->refCount + j];
+                
+                if ( table )
+                {
+                    cout << '\t';
+                    
+                    if ( pair->pass )
+                    {
+                        cout << pair->distance;
+                    }
+                }
+                else if ( pair->pass )
+                {
+                    const Sketch::Reference & refRef = sketchRef.getReference(output->indexRef + j);
+                    
+                    cout << refRef.name;
+                    
+                    if ( comment )
+                    {
+                        cout << ':' << refRef.comment;
+                    }
+                    
+                    cout << '\t' << refQry.name;
+                    
+                    if ( comment )
+                    {
+                        cout << ':' << refQry.comment;
+                    }
+                    
+                    cout << '\t' << pair->distance << '\t' << pair->pValue << '\t' << pair->numer << '/' << pair->denom << endl;
+                }
             }
-            
-            j = 0;
-            i++;
+        }
+        
+        if ( table )
+        {
+            cout << endl;
         }
     }
     
-    delete output;
+    for ( uint64_t tile = 0; tile < band.size(); tile++ )
+    {
+        delete band[tile];
+    }
 }
 
 CommandDistance::CompareOutput * compare(CommandDistance::CompareInput * input)
@@ -308,80 +469,161 @@ CommandDistance::CompareOutput * compare(CommandDistance::CompareInput * input)
     const Sketch & sketchRef = input->sketchRef;
     const Sketch & sketchQuery = input->sketchQuery;
     
-    CommandDistance::CompareOutput * output = new CommandDistance::CompareOutput(input->sketchRef, input->sketchQuery, input->indexRef, input->indexQuery, input->pairCount);
+    CommandDistance::CompareOutput * output = new CommandDistance::CompareOutput(input->sketchRef, input->sketchQuery, input->indexRef, input->indexQuery, input->refCount, input->queryCount);
     
     uint64_t sketchSize = sketchQuery.getMinHashesPerWindow() < sketchRef.getMinHashesPerWindow() ?
         sketchQuery.getMinHashesPerWindow() :
         sketchRef.getMinHashesPerWindow();
     
-    uint64_t i = input->indexQuery;
-    uint64_t j = input->indexRef;
+    if ( input->index )
+    {
+        compareIndexed(input, output, sketchSize);
+        return output;
+    }
     
-    for ( uint64_t k = 0; k < input->pairCount && i < sketchQuery.getReferenceCount(); k++ )
+    for ( uint64_t i = 0; i < input->queryCount; i++ )
     {
-        compareSketches(&output->pairs[k], sketchRef.getReference(j), sketchQuery.getReference(i), sketchSize, sketchRef.getKmerSize(), sketchRef.getKmerSpace(), input->maxDistance, input->maxPValue);
-        
-        j++;
+        const Sketch::Reference & refQry = sketchQuery.getReference(input->indexQuery + i);
+        priority_queue<CommandDistance::BestPair> heap;
         
-        if ( j == sketchRef.getReferenceCount() )
+        for ( uint64_t j = 0; j < input->refCount; j++ )
         {
-            j = 0;
-            i++;
+            CommandDistance::CompareOutput::PairOutput * pair = &output->pairs[i * input->refCount + j];
+            double maxDistance = input->maxDistance;
+            
+            // with enough references kept, others only need to be closer
+            // than the furthest of them, which lets the merge stop early
+            //
+            if ( input->best && heap.size() == input->best && heap.top().distance < maxDistance )
+            {
+                maxDistance = heap.top().distance;
+            }
+            
+            compareSketches(pair, sketchRef.getReference(input->indexRef + j), refQry, sketchSize, sketchRef.getKmerSize(), sketchRef.getKmerSpace(), maxDistance, input->maxPValue, input->cascade);
+            
+            if ( input->best )
+            {
+                keepBest(heap, input->best, input->indexRef + j, pair);
+            }
         }
     }
     
     return output;
 }
 
-void compareSketches(CommandDistance::CompareOutput::PairOutput * output, const Sketch::Reference & refRef, const Sketch::Reference & refQry, uint64_t sketchSize, int kmerSize, double kmerSpace, double maxDistance, double maxPValue)
+void compareIndexed(const CommandDistance::CompareInput * input, CommandDistance::CompareOutput * output, uint64_t sketchSize)
+{
+    const Sketch & sketchRef = input->sketchRef;
+    const Sketch & sketchQuery = input->sketchQuery;
+    uint64_t referenceCount = sketchRef.getReferenceCount();
+    
+    vector<uint64_t> candidates((referenceCount + 63) / 64);
+    
+    // references without a shared hash have none among the bottom hashes of
+    // the union either, so their pairs are known without merging: nothing in
+    // common and a union of both sketches up to the sketch size
+    
+    bool passUnrelated = (input->maxDistance < 0 || input->maxDistance >= 1) && (input->maxPValue < 0 || input->maxPValue >= 1);
+    
+    for ( uint64_t i = 0, k = 0; i < input->queryCount; i++ )
+    {
+        const Sketch::Reference & refQry = sketchQuery.getReference(input->indexQuery + i);
+        priority_queue<CommandDistance::BestPair> heap;
+        
+        fill(candidates.begin(), candidates.end(), 0);
+        input->index->getCandidates(refQry.hashesSorted, candidates.data());
+        
+        for ( uint64_t j = 0; j < referenceCount; j++, k++ )
+        {
+            CommandDistance::CompareOutput::PairOutput * pair = &output->pairs[k];
+            const Sketch::Reference & refRef = sketchRef.getReference(j);
+            
+            uint64_t denom = refRef.hashesSorted.size() + refQry.hashesSorted.size();
+            
+            if ( denom == 0 || (candidates[j / 64] & (uint64_t(1) << (j % 64))) )
+            {
+                compareSketches(pair, refRef, refQry, sketchSize, sketchRef.getKmerSize(), sketchRef.getKmerSpace(), input->maxDistance, input->maxPValue, input->cascade);
+            }
+            else
+            {
+                pair->numer = 0;
+                pair->denom = denom < sketchSize ? denom : sketchSize;
+                pair->distance = 1.;
+                pair->pValue = 1.;
+                pair->pass = passUnrelated;
+            }
+            
+            if ( input->best )
+            {
+                keepBest(heap, input->best, j, pair);
+            }
+        }
+    }
+}
+
+void compareSketches(CommandDistance::CompareOutput::PairOutput * output, const Sketch::Reference & refRef, const Sketch::Reference & refQry, uint64_t sketchSize, int kmerSize, double kmerSpace, double maxDistance, double maxPValue, const CascadeScreen * cascade)
 {
-    uint64_t i = 0;
-    uint64_t j = 0;
-    uint64_t common = 0;
-    uint64_t denom = 0;
+    uint64_t common;
+    uint64_t denom;
     const HashList & hashesSortedRef = refRef.hashesSorted;
     const HashList & hashesSortedQry = refQry.hashesSorted;
     
     output->pass = false;
     
-    while ( denom < sketchSize && i < hashesSortedRef.size() && j < hashesSortedQry.size() )
+    if ( cascade != 0 && cascade->prefixSize < sketchSize )
     {
-        if ( hashLessThan(hashesSortedRef.at(i), hashesSortedQry.at(j), hashesSortedRef.get64()) )
-        {
-            i++;
-        }
-        else if ( hashLessThan(hashesSortedQry.at(j), hashesSortedRef.at(i), hashesSortedRef.get64()) )
+        uint64_t sizeRef = min(uint64_t(hashesSortedRef.size()), cascade->prefixSize);
+        uint64_t sizeQry = min(uint64_t(hashesSortedQry.size()), cascade->prefixSize);
+        
+        if ( hashesSortedRef.get64() )
         {
-            j++;
+            getCpuKernels().countShared64(hashesSortedRef.data64(), sizeRef, hashesSortedQry.data64(), sizeQry, cascade->prefixSize, 0, common, denom);
         }
         else
         {
-            i++;
-            j++;
-            common++;
+            getCpuKernels().countShared32(hashesSortedRef.data32(), sizeRef, hashesSortedQry.data32(), sizeQry, cascade->prefixSize, 0, common, denom);
         }
         
-        denom++;
+        if ( int64_t(common) <= cascade->sharedMax[denom] )
+        {
+            return;
+        }
     }
     
-    if ( denom < sketchSize )
+    // Passing maxDistance needs a Jaccard index of at least jaccardMin, and
+    // the denominator is at least the larger sketch (up to the sketch size),
+    // so pairs with fewer shared hashes than that can be dropped as soon as
+    // the merge shows they cannot reach it. The bound is loosened slightly so
+    // rounding never drops a pair that would pass.
+    
+    uint64_t commonMin = 0;
+    
+    if ( maxDistance >= 0 && maxDistance < 1 )
     {
-        // complete the union operation if possible
-        
-        if ( i < hashesSortedRef.size() )
-        {
-            denom += hashesSortedRef.size() - i;
-        }
+        double ratio = exp(-kmerSize * maxDistance);
+        double jaccardMin = ratio / (2. - ratio);
+        uint64_t denomMin = max(hashesSortedRef.size(), hashesSortedQry.size());
         
-        if ( j < hashesSortedQry.size() )
+        if ( denomMin > sketchSize )
         {
-            denom += hashesSortedQry.size() - j;
+            denomMin = sketchSize;
         }
         
-        if ( denom > sketchSize )
-        {
-            denom = sketchSize;
-        }
+        commonMin = jaccardMin * denomMin * (1. - 1e-9);
+    }
+    
+    if ( hashesSortedRef.get64() )
+    {
+        getCpuKernels().countShared64(hashesSortedRef.data64(), hashesSortedRef.size(), hashesSortedQry.data64(), hashesSortedQry.size(), sketchSize, commonMin, common, denom);
+    }
+    else
+    {
+        getCpuKernels().countShared32(hashesSortedRef.data32(), hashesSortedRef.size(), hashesSortedQry.data32(), hashesSortedQry.size(), sketchSize, commonMin, common, denom);
+    }
+    
+    if ( common < commonMin )
+    {
+        return;
     }
     
     double distance;
@@ -424,6 +666,25 @@ void compareSketches(CommandDistance::CompareOutput::PairOutput * output, const
     output->pass = true;
 }
 
+void keepBest(priority_queue<CommandDistance::BestPair> & heap, uint64_t best, uint64_t index, CommandDistance::CompareOutput::PairOutput * pair)
+{
+    // the heap holds the closest passing pairs so far, furthest on top;
+    // pairs that drop out no longer pass
+    
+    if ( ! pair->pass )
+    {
+        return;
+    }
+    
+    heap.push(CommandDistance::BestPair(pair->distance, index, pair));
+    
+    if ( heap.size() > best )
+    {
+        heap.top().pair->pass = false;
+        heap.pop();
+    }
+}
+
 double pValue(uint64_t x, uint64_t lengthRef, uint64_t lengthQuery, double kmerSpace, uint64_t sketchSize)
 {
     if ( x == 0 )
@@ -447,4 +708,42 @@ double pValue(uint64_t x, uint64_t lengthRef, uint64_t lengthQuery, double kmerS
 #endif
 }
 
+void setCascadeScreen(CascadeScreen & cascade, uint64_t prefixSize, double maxDistance, int kmerSize, double probability)
+{
+    // Under the binomial model of CommandBounds, the shared count of a
+    // prefix with denom hashes, for a pair right at the threshold, is only
+    // this low with (1 - probability) / 2 chance; pairs further beyond the
+    // threshold are even more likely to be this low.
+    
+    double ratio = exp(-kmerSize * maxDistance);
+    double jaccard = ratio / (2. - ratio);
+    double q2 = (1. - probability) / 2.;
+    
+    cascade.prefixSize = prefixSize;
+    cascade.sharedMax.resize(prefixSize + 1);
+    cascade.sharedMax[0] = -1;
+    
+    for ( uint64_t denom = 1; denom <= prefixSize; denom++ )
+    {
+        uint64_t x = 0;
+        
+        while ( x < denom )
+        {
+#ifdef USE_BOOST
+            double cdfx = cdf(binomial(denom, jaccard), x);
+#else
+            double cdfx = gsl_cdf_binomial_P(x, jaccard, denom);
+#endif
+            if ( cdfx >= q2 )
+            {
+                break;
+            }
+            
+            x++;
+        }
+        
+        cascade.sharedMax[denom] = int64_t(x) - 1;
+    }
+}
+
 } // namespace mash
@@ -9,50 +9,83 @@
 
 #include "Command.h"
 #include "Sketch.h"
+#include "SketchIndex.h"
+#include <queue>
 
 namespace mash {
 
+// Screening of pairs on the first prefixSize hashes of their sketches (see
+// -cascade). Prefixes of sorted sketches are sketches themselves; pairs whose
+// prefixes share at most sharedMax[denom] of denom hashes are beyond the
+// distance threshold with the chosen probability and are dropped without
+// comparing the whole sketches.
+//
+struct CascadeScreen
+{
+    uint64_t prefixSize;
+    std::vector<int64_t> sharedMax;
+};
+
 class CommandDistance : public Command
 {
 public:
     
     struct CompareInput
     {
-        CompareInput(const Sketch & sketchRefNew, const Sketch & sketchQueryNew, uint64_t indexRefNew, uint64_t indexQueryNew, uint64_t pairCountNew, const Sketch::Parameters & parametersNew, double maxDistanceNew, double maxPValueNew)
+        CompareInput(const Sketch & sketchRefNew, const Sketch & sketchQueryNew, uint64_t indexRefNew, uint64_t indexQueryNew, uint64_t refCountNew, uint64_t queryCountNew, const Sketch::Parameters & parametersNew, double maxDistanceNew, double maxPValueNew, uint64_t bestNew, const SketchIndex * indexNew, const CascadeScreen * cascadeNew)
             :
             sketchRef(sketchRefNew),
             sketchQuery(sketchQueryNew),
             indexRef(indexRefNew),
             indexQuery(indexQueryNew),
-            pairCount(pairCountNew),
+            refCount(refCountNew),
+            queryCount(queryCountNew),
             parameters(parametersNew),
             maxDistance(maxDistanceNew),
-            maxPValue(maxPValueNew)
+            maxPValue(maxPValueNew),
+            best(bestNew),
+            index(indexNew),
+            cascade(cascadeNew)
             {}
         
         const Sketch & sketchRef;
         const Sketch & sketchQuery;
         
+        // a tile of refCount references by queryCount queries
+        //
         uint64_t indexRef;
         uint64_t indexQuery;
-        uint64_t pairCount;
+        uint64_t refCount;
+        uint64_t queryCount;
         
         const Sketch::Parameters & parameters;
         double maxDistance;
         double maxPValue;
+        
+        // if set, only this many closest references pass for each query
+        //
+        uint64_t best;
+        
+        // if set, tiles cover all references and only references that share
+        // a hash with the query (according to the index) are merged
+        //
+        const SketchIndex * index;
+        
+        const CascadeScreen * cascade;
     };
     
     struct CompareOutput
     {
-        CompareOutput(const Sketch & sketchRefNew, const Sketch & sketchQueryNew, uint64_t indexRefNew, uint64_t indexQueryNew, uint64_t pairCountNew)
+        CompareOutput(const Sketch & sketchRefNew, const Sketch & sketchQueryNew, uint64_t indexRefNew, uint64_t indexQueryNew, uint64_t refCountNew, uint64_t queryCountNew)
             :
             sketchRef(sketchRefNew),
             sketchQuery(sketchQueryNew),
             indexRef(indexRefNew),
             indexQuery(indexQueryNew),
-            pairCount(pairCountNew)
+            refCount(refCountNew),
+            queryCount(queryCountNew)
         {
-            pairs = new PairOutput[pairCount];
+            pairs = new PairOutput[refCount * queryCount];
         }
         
         ~CompareOutput()
@@ -74,9 +107,32 @@ public:
         
         uint64_t indexRef;
         uint64_t indexQuery;
-        uint64_t pairCount;
+        uint64_t refCount;
+        uint64_t queryCount;
+        
+        PairOutput * pairs; // by query, then reference
+    };
+    
+    // a passing pair, ordered by distance and then reference index, for
+    // keeping the closest references to a query (-best)
+    //
+    struct BestPair
+    {
+        BestPair(double distanceNew, uint64_t indexNew, CompareOutput::PairOutput * pairNew)
+            :
+            distance(distanceNew),
+            index(indexNew),
+            pair(pairNew)
+            {}
+        
+        bool operator<(const BestPair & other) const
+        {
+            return distance < other.distance || (distance == other.distance && index < other.index);
+        }
         
-        PairOutput * pairs;
+        double distance;
+        uint64_t index;
+        CompareOutput::PairOutput * pair;
     };
     
     CommandDistance();
@@ -85,12 +141,17 @@ public:
     
 private:
     
-    void writeOutput(CompareOutput * output, bool table, bool comment) const;
+    // writes (and deletes) the tiles of a band of queries, in reference order
+    //
+    void writeOutput(const std::vector<CompareOutput *> & band, bool table, bool comment, uint64_t best) const;
 };
 
 CommandDistance::CompareOutput * compare(CommandDistance::CompareInput * input);
-void compareSketches(CommandDistance::CompareOutput::PairOutput * output, const Sketch::Reference & refRef, const Sketch::Reference & refQry, uint64_t sketchSize, int kmerSize, double kmerSpace, double maxDistance, double maxPValue);
+void compareIndexed(const CommandDistance::CompareInput * input, CommandDistance::CompareOutput * output, uint64_t sketchSize);
+void compareSketches(CommandDistance::CompareOutput::PairOutput * output, const Sketch::Reference & refRef, const Sketch::Reference & refQry, uint64_t sketchSize, int kmerSize, double kmerSpace, double maxDistance, double maxPValue, const CascadeScreen * cascade);
+void keepBest(std::priority_queue<CommandDistance::BestPair> & heap, uint64_t best, uint64_t index, CommandDistance::CompareOutput::PairOutput * pair);
 double pValue(uint64_t x, uint64_t lengthRef, uint64_t lengthQuery, double kmerSpace, uint64_t sketchSize);
+void setCascadeScreen(CascadeScreen & cascade, uint64_t prefixSize, double maxDistance, int kmerSize, double probability);
 
 } // namespace mash
 
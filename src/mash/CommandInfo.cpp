@@ -6,6 +6,7 @@
 
 #include "CommandInfo.h"
 #include "Sketch.h"
+#include "cpuDispatch.h"
 #include <iostream>
 
 using std::cerr;
@@ -16,12 +17,6 @@ using std::vector;
 
 namespace mash {
 
-#ifdef ARCH_32
-	#define HASH "MurmurHash3_x86_32"
-#else
-	#define HASH "MurmurHash3_x64_128"
-#endif
-
 CommandInfo::CommandInfo()
 : Command()
 {
@@ -35,6 +30,7 @@ CommandInfo::CommandInfo()
     addOption("tabular", Option(Option::Boolean, "t", "", "Tabular output (rather than padded), with no header. Incompatible with -d, -H and -c.", ""));
     addOption("counts", Option(Option::Boolean, "c", "", "Show hash count histograms for each sketch. Incompatible with -d, -H and -t.", ""));
     addOption("dump", Option(Option::Boolean, "d", "", "Dump sketches in JSON format. Incompatible with -H, -t, and -c.", ""));
+    addOption("id", Option(Option::String, "i", "", "Only show the sketch with this ID. Sketch files written by this version find it through an index, without loading the others. Incompatible with -H.", ""));
 }
 
 int CommandInfo::run() const
@@ -49,6 +45,7 @@ int CommandInfo::run() const
     bool tabular = options.at("tabular").active;
     bool counts = options.at("counts").active;
     bool dump = options.at("dump").active;
+    bool id = options.at("id").active;
     
     if ( header && tabular )
     {
@@ -68,6 +65,12 @@ int CommandInfo::run() const
     	return 1;
     }
     
+    if ( header && id )
+    {
+    	cerr << "ERROR: The options -H and -i are incompatible." << endl;
+    	return 1;
+    }
+	
 	if ( dump )
 	{
 		if ( tabular )
@@ -100,6 +103,7 @@ int CommandInfo::run() const
 	Sketch sketch;
 	Sketch::Parameters params;
 	params.parallelism = 1;
+	params.mapped = true;
 	
 	uint64_t referenceCount;
 	
@@ -107,6 +111,16 @@ int CommandInfo::run() const
 	{
 		referenceCount = sketch.initParametersFromCapnp(arguments[0].c_str());
 	}
+	else if ( id )
+	{
+		sketch.initFromCapnpById(arguments[0].c_str(), vector<string>(1, options.at("id").argument), params);
+		referenceCount = sketch.getReferenceCount();
+		
+		if ( referenceCount == 0 )
+		{
+			return 1;
+		}
+	}
 	else
 	{
 	    sketch.initFromFiles(arguments, params);
@@ -132,11 +146,12 @@ int CommandInfo::run() const
     	sketch.getAlphabetAsString(alphabet);
     	
 		cout << "Header:" << endl;
-		cout << "  Hash function (seed):          " << HASH << " (" << sketch.getHashSeed() << ")" << endl;
+		cout << "  Hash function (seed):          " << getHashFunctionName(sketch.getHashFunction()) << " (" << sketch.getHashSeed() << ")" << endl;
 		cout << "  K-mer size:                    " << sketch.getKmerSize() << " (" << (sketch.getUse64() ? "64" : "32") << "-bit hashes)" << endl;
 		cout << "  Alphabet:                      " << alphabet << (sketch.getNoncanonical() ? "" : " (canonical)") << (sketch.getPreserveCase() ? " (case-sensitive)" : "") << endl;
 		cout << "  Target min-hashes per sketch:  " << sketch.getMinHashesPerWindow() << endl;
 		cout << "  Sketches:                      " << referenceCount << endl;
+		cout << "  Kernels (this host):           " << getCpuVariantName(getCpuVariant()) << endl;
 	}
 	
     if ( ! header )
@@ -231,7 +246,7 @@ int CommandInfo::writeJson(const Sketch & sketch) const
 	cout << "	\"preserveCase\" : " << (sketch.getPreserveCase() ? "true" : "false") << ',' << endl;
 	cout << "	\"canonical\" : " << (sketch.getNoncanonical() ? "false" : "true") << ',' << endl;
 	cout << "	\"sketchSize\" : " << sketch.getMinHashesPerWindow() << ',' << endl;
-	cout << "	\"hashType\" : \"" << HASH << "\"," << endl;
+	cout << "	\"hashType\" : \"" << getHashFunctionName(sketch.getHashFunction()) << "\"," << endl;
 	cout << "	\"hashBits\" : " << (use64 ? 64 : 32) << ',' << endl;
 	cout << "	\"hashSeed\" : " << sketch.getHashSeed() << ',' << endl;
 	cout << " 	\"sketches\" :" << endl;
@@ -250,7 +265,7 @@ int CommandInfo::writeJson(const Sketch & sketch) const
 		
 		for ( int j = 0; j < ref.hashesSorted.size(); j++ )
 		{
-			cout << "				" << ( use64 ? ref.hashesSorted.at(j).hash64 : ref.hashesSorted.at(j).hash32 );
+			cout << "				" << ( use64 ? ref.hashesSorted.data<hash64_t>()[j] : ref.hashesSorted.data<hash32_t>()[j] );
 			
 			if ( j < ref.hashesSorted.size() - 1 )
 			{
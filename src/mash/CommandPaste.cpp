@@ -6,8 +6,11 @@
 
 #include "CommandPaste.h"
 #include "Sketch.h"
+#include "SketchManifest.h"
 #include <iostream>
 #include "unistd.h"
+#include <limits.h>
+#include <stdlib.h>
 
 using std::string;
 using std::cerr;
@@ -25,6 +28,8 @@ CommandPaste::CommandPaste()
     
     useOption("help");
     addOption("list", Option(Option::Boolean, "l", "", "Input files are lists of file names.", ""));
+    addOption("manifest", Option(Option::Boolean, "m", "", "Write a manifest (<out_prefix>.mshm) that lists the input sketch files as shards of one database, rather than copying their sketches. Manifests can be given to other commands in place of sketch files, with an optional subset of shards by index (e.g. db.mshm:0-3,7). Incompatible with -a.", ""));
+    addOption("append", Option(Option::Boolean, "a", "", "Append to <out_prefix>.msh, which must exist, rather than creating it. Only the new sketches are read and written. Sketches whose parameters do not match the existing file are skipped. The first append converts the file to segments, after which it is rejected as malformed by versions of Mash that predate this option.", ""));
 }
 
 int CommandPaste::run() const
@@ -68,13 +73,49 @@ int CommandPaste::run() const
         filesGood.push_back(file);
     }
     
-	sketch.initFromFiles(filesGood, parameters);
+    if ( options.at("manifest").active )
+    {
+    	if ( options.at("append").active )
+    	{
+			cerr << "ERROR: The options -m and -a are incompatible." << endl;
+			return 1;
+    	}
+    	
+    	return writeManifest(filesGood);
+    }
+    
     string out = arguments[0];
     
     if ( ! hasSuffix(out, suffixSketch) )
     {
         out += suffixSketch;
     }
+    
+    if ( options.at("append").active )
+    {
+		if( access(out.c_str(), F_OK) == -1 )
+		{
+			cerr << "ERROR: \"" << out << "\" does not exist; leave out -a to create it." << endl;
+			exit(1);
+		}
+		
+		// new sketches must match the existing file
+		//
+		Sketch sketchOut;
+		sketchOut.initParametersFromCapnp(out.c_str());
+		
+		Sketch::Parameters parametersOut = sketchOut.getParameters();
+		parametersOut.parallelism = 1;
+		
+		sketch.initFromFiles(filesGood, parametersOut, 0, true);
+	    
+	    cerr << "Appending " << sketch.getReferenceCount() << " sketches to " << out << "..." << endl;
+	    sketch.appendToCapnp(out.c_str());
+	    
+	    return 0;
+    }
+	
+	sketch.initFromFiles(filesGood, parameters);
 
 	if( access(out.c_str(), F_OK) != -1 )
 	{
@@ -88,4 +129,66 @@ int CommandPaste::run() const
     return 0;
 }
 
+int CommandPaste::writeManifest(const std::vector<string> & files) const
+{
+    string out = arguments[0];
+    
+    if ( ! hasSuffix(out, suffixManifest) )
+    {
+        out += suffixManifest;
+    }
+	
+	if( access(out.c_str(), F_OK) != -1 )
+	{
+		cerr << "ERROR: \"" << out << "\" exists; remove to write." << endl;
+		exit(1);
+	}
+	
+	// shard paths are relative to the manifest, so keep them as given only if
+	// it is in the working directory
+	//
+	bool relative = out.find('/') == string::npos;
+	
+	SketchManifest manifest;
+	Sketch::Parameters parameters;
+	
+	parameters.parallelism = 1;
+	parameters.mapped = true;
+	
+	for ( int i = 0; i < files.size(); i++ )
+	{
+		// shards after the first must match it
+		//
+		Sketch shard;
+		shard.initFromFiles(std::vector<string>(1, files[i]), parameters, 0, i > 0);
+		
+		if ( i == 0 )
+		{
+			parameters = shard.getParameters();
+			manifest.setParameters(shard);
+		}
+		
+		if ( shard.getReferenceCount() == 0 )
+		{
+			cerr << "WARNING: No sketches loaded from " << files[i] << "; it will not be listed." << endl;
+			continue;
+		}
+		
+		char path[PATH_MAX];
+		
+		if ( ! relative && realpath(files[i].c_str(), path) == 0 )
+		{
+			cerr << "ERROR: could not find the full path of " << files[i] << "." << endl;
+			exit(1);
+		}
+		
+		manifest.addShard(relative ? files[i] : string(path), shard);
+	}
+    
+    cerr << "Writing " << out << "..." << endl;
+	manifest.write(out);
+	
+	return 0;
+}
+
 } // namespace mash
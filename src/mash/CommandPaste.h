@@ -19,6 +19,10 @@ public:
     CommandPaste();
     
     int run() const; // override
+
+private:
+
+	int writeManifest(const std::vector<std::string> & files) const;
 };
 
 } // namespace mash
@@ -7,12 +7,15 @@
 #include "CommandScreen.h"
 #include "CommandDistance.h" // for pvalue
 #include "Sketch.h"
+#include "SketchManifest.h"
 #include "kseq.h"
 #include <iostream>
 #include <zlib.h>
 #include "ThreadPool.h"
 #include <math.h>
 #include "robin_hood.h"
+#include "cpuDispatch.h"
+#include "ntHash.h"
 
 #ifdef USE_BOOST
 	#include <boost/math/distributions/binomial.hpp>
@@ -59,9 +62,9 @@ int CommandScreen::run() const
 		return 0;
 	}
 	
-	if ( ! hasSuffix(arguments[0], suffixSketch) )
+	if ( ! hasSuffix(arguments[0], suffixSketch) && ! isManifest(arguments[0]) )
 	{
-		cerr << "ERROR: " << arguments[0] << " does not look like a sketch (.msh)" << endl;
+		cerr << "ERROR: " << arguments[0] << " does not look like a sketch (.msh) or sketch manifest (.mshm)" << endl;
 		exit(1);
 	}
 	
@@ -75,6 +78,8 @@ int CommandScreen::run() const
 	
 	Sketch sketch;
     Sketch::Parameters parameters;
+    
+    parameters.mapped = true;
 	
     sketch.initFromFiles(refArgVector, parameters);
     
@@ -88,6 +93,7 @@ int CommandScreen::run() const
 	parameters.use64 = sketch.getUse64();
 	parameters.preserveCase = sketch.getPreserveCase();
 	parameters.seed = sketch.getHashSeed();
+	parameters.hashFunction = sketch.getHashFunction();
 	parameters.minHashesPerWindow = sketch.getMinHashesPerWindow();
 	
 	HashTable hashTable;
@@ -102,7 +108,7 @@ int CommandScreen::run() const
 		
 		for ( int j = 0; j < hashes.size(); j++ )
 		{
-			uint64_t hash = hashes.get64() ? hashes.at(j).hash64 : hashes.at(j).hash32;
+			uint64_t hash = hashes.get64() ? hashes.data<hash64_t>()[j] : hashes.data<hash32_t>()[j];
 			
 			if ( hashTable.count(hash) == 0 )
 			{
@@ -481,6 +487,45 @@ double estimateIdentity(uint64_t common, uint64_t denom, int kmerSize, double km
 	return identity;
 }
 
+void insertHash(CommandScreen::HashInput * input, hash_u hash)
+{
+	uint64_t key = input->parameters.use64 ? hash.hash64 : hash.hash32;
+	
+	input->minHashHeap->tryInsert(hash);
+	
+	if ( input->hashCounts.count(key) == 1 )
+	{
+		input->hashCounts[key]++;
+	}
+}
+
+void insertHashes(CommandScreen::HashInput * input, const char * const * kmers, int count)
+{
+	hash_u hashes[hashBatchSize];
+	
+	getHashes(kmers, count, input->parameters.kmerSize, input->parameters.seed, input->parameters.use64, hashes);
+	
+	for ( int i = 0; i < count; i++ )
+	{
+		insertHash(input, hashes[i]);
+	}
+}
+
+// Amino acids are valid wherever translation did not give a stop ('*')
+//
+static const struct TranslatedAlphabet
+{
+	TranslatedAlphabet()
+	{
+		for ( int i = 0; i < 256; i++ )
+		{
+			alphabet[i] = i >= 'A' && i <= 'Z';
+		}
+	}
+	
+	bool alphabet[256];
+} translatedAlphabet;
+
 CommandScreen::HashOutput * hashSequence(CommandScreen::HashInput * input)
 {
 	CommandScreen::HashOutput * output = new CommandScreen::HashOutput(input->minHashHeap);
@@ -488,100 +533,135 @@ CommandScreen::HashOutput * hashSequence(CommandScreen::HashInput * input)
 	int l = input->length;
 	bool trans = input->trans;
 	
-	bool use64 = input->parameters.use64;
-	uint32_t seed = input->parameters.seed;
 	int kmerSize = input->parameters.kmerSize;
 	bool noncanonical = input->parameters.noncanonical;
 	
 	char * seq = input->seq;
 	
-	// uppercase
-	//
-	for ( uint64_t i = 0; i < l; i++ )
+	if ( input->parameters.hashFunction == hashFunctionNtHash )
 	{
-		if ( ! input->parameters.preserveCase && seq[i] > 96 && seq[i] < 123 )
+		// rolling hashes need no k-mer extraction or reverse complement
+		
+		if ( ! input->parameters.preserveCase )
+		{
+			getCpuKernels().uppercase(seq, l);
+		}
+		
+		NtHash ntHash(kmerSize, input->parameters.seed, ! noncanonical);
+		hash_u hash;
+		
+		for ( uint64_t i = 0; i < l; i++ )
 		{
-			seq[i] -= 32;
+			if ( ntHash.roll(seq, i) )
+			{
+				if ( input->parameters.use64 )
+				{
+					hash.hash64 = ntHash.hash();
+				}
+				else
+				{
+					hash.hash32 = ntHash.hash();
+				}
+				
+				insertHash(input, hash);
+			}
 		}
+		
+		return output;
 	}
 	
+	// Buffers are reused across chunks by each thread. For nucleotide k-mers,
+	// uppercasing and finding valid characters is done in one pass; for
+	// translated k-mers, all six frames are translated in one pass.
+	//
+	static thread_local vector<uint64_t> valid;
+	static thread_local vector<char> translated;
+	
 	char * seqRev;
+	char * frames[6];
 	
-	if ( ! noncanonical || trans )
+	if ( trans )
+	{
+		translated.resize(2 * l);
+		
+		for ( int i = 0, offset = 0; i < 6; i++ )
+		{
+			frames[i] = translated.data() + offset;
+			offset += (l - i % 3) / 3;
+		}
+		
+		translateFrames(seq, l, input->parameters.preserveCase, frames);
+	}
+	else
 	{
-		seqRev = new char[l];
-		reverseComplement(seq, seqRev, l);
+		valid.resize((l + 63) / 64);
+		getCpuKernels().normalize(seq, l, ! input->parameters.preserveCase, input->parameters.alphabet, valid.data());
+		
+		if ( ! noncanonical )
+		{
+			seqRev = new char[l];
+			reverseComplement(seq, seqRev, l);
+		}
 	}
 	
+	const char * kmers[hashBatchSize];
+	int batch = 0;
+	
 	for ( int i = 0; i < (trans ? 6 : 1); i++ )
 	{
 		bool useRevComp = false;
 		int frame = i % 3;
-		bool rev = i > 2;
 		
 		int lenTrans = (l - frame) / 3;
 		
-		char * seqTrans;
+		char * seqTrans = trans ? frames[i] : 0;
 		
 		if ( trans )
 		{
-			seqTrans = new char[lenTrans];
-			translate((rev ? seqRev : seq) + frame, seqTrans, lenTrans);
+			valid.resize((lenTrans + 63) / 64);
+			getCpuKernels().normalize(seqTrans, lenTrans, false, translatedAlphabet.alphabet, valid.data());
 		}
 		
-		int64_t lastGood = -1;
 		int length = trans ? lenTrans : l;
 		
-		for ( int j = 0; j < length - kmerSize + 1; j++ )
+		// jump between runs of valid characters
+		//
+		for ( int64_t start = findBit(valid.data(), 0, length, true); start + kmerSize <= length; )
 		{
-			while ( lastGood < j + kmerSize - 1 && lastGood < length )
+			int64_t end = findBit(valid.data(), start, length, false);
+			
+			for ( int64_t j = start; j + kmerSize <= end; j++ )
 			{
-				lastGood++;
+				const char * kmer;
 				
-				if ( trans ? (seqTrans[lastGood] == '*') : (!input->parameters.alphabet[seq[lastGood]]) )
+				if ( trans )
 				{
-					j = lastGood + 1;
+					kmer = seqTrans + j;
+				}
+				else
+				{
+					const char *kmer_fwd = seq + j;
+					const char *kmer_rev = seqRev + length - j - kmerSize;
+					kmer = (noncanonical || memcmp(kmer_fwd, kmer_rev, kmerSize) <= 0) ? kmer_fwd : kmer_rev;
+				}
+				
+				//cout << kmer << '\t' << kmerSize << endl;
+				kmers[batch++] = kmer;
+				
+				if ( batch == hashBatchSize )
+				{
+					insertHashes(input, kmers, batch);
+					batch = 0;
 				}
 			}
 			
-			if ( j > length - kmerSize )
-			{
-				break;
-			}
-			
-			const char * kmer;
-			
-			if ( trans )
-			{
-				kmer = seqTrans + j;
-			}
-			else
-			{
-				const char *kmer_fwd = seq + j;
-				const char *kmer_rev = seqRev + length - j - kmerSize;
-				kmer = (noncanonical || memcmp(kmer_fwd, kmer_rev, kmerSize) <= 0) ? kmer_fwd : kmer_rev;
-			}
-			
-			//cout << kmer << '\t' << kmerSize << endl;
-			hash_u hash = getHash(kmer, kmerSize, seed, use64);
-			//cout << kmer << '\t' << hash.hash64 << endl;
-			input->minHashHeap->tryInsert(hash);
-			uint64_t key = use64 ? hash.hash64 : hash.hash32;
-			
-			if ( input->hashCounts.count(key) == 1 )
-			{
-				//cout << "Incrementing " << key << endl;
-				input->hashCounts[key]++;
-			}
-		}
-		
-		if ( trans )
-		{
-			delete [] seqTrans;
+			start = findBit(valid.data(), end, length, true);
 		}
 	}
 	
-	if ( ! noncanonical || trans )
+	insertHashes(input, kmers, batch);
+	
+	if ( ! noncanonical && ! trans )
 	{
 		delete [] seqRev;
 	}
@@ -614,198 +694,108 @@ double pValueWithin(uint64_t x, uint64_t setSize, double kmerSpace, uint64_t ske
 #endif
 }
 
-void translate(const char * src, char * dst, uint64_t len)
+// Standard genetic code indexed by 2-bit codons (A=0, C=1, G=2, T=3), with
+// '*' for stops and for codons containing anything else (index 64)
+//
+static const struct CodonTables
 {
-	for ( uint64_t n = 0, a = 0; a < len; a++, n+= 3 )
+	CodonTables()
 	{
-		dst[a] = aaFromCodon(src + n);
+		const char * aas = "KNKNTTTTRSRSIIMIQHQHPPPPRRRRLLLLEDEDAAAAGGGGVVVV*Y*YSSSS*CWCLFLF";
+		
+		for ( int i = 0; i < 256; i++ )
+		{
+			codes[0][i] = 4;
+			codes[1][i] = 4;
+		}
+		
+		const char * bases = "ACGT";
+		
+		for ( int i = 0; i < 4; i++ )
+		{
+			codes[0][(unsigned char)bases[i]] = i;
+			codes[0][(unsigned char)bases[i] + 'a' - 'A'] = i;
+			codes[1][(unsigned char)bases[i]] = i;
+		}
+		
+		for ( int i = 0; i < 64; i++ )
+		{
+			// the reverse strand reads the codon backwards and complemented
+			
+			int reverse = (3 - (i & 3)) << 4 | (3 - (i >> 2 & 3)) << 2 | (3 - (i >> 4));
+			
+			aaForward[i] = aas[i];
+			aaReverse[i] = aas[reverse];
+		}
+		
+		aaForward[64] = '*';
+		aaReverse[64] = '*';
 	}
-}
+	
+	uint8_t codes[2][256]; // [case sensitive], 4 if not a base
+	char aaForward[65];
+	char aaReverse[65];
+} codonTables;
 
-char aaFromCodon(const char * codon)
+void translateFrames(const char * seq, uint64_t length, bool preserveCase, char * frames[6])
 {
-	string str(codon, 3);
-	/*
-	if ( codons.count(str) == 1 )
-	{
-		return codons.at(str);
-	}
-	else
+	// The codon starting at each position is in one forward frame and, read
+	// backwards, in one reverse frame, so all six come from one pass with a
+	// rolling codon index. Frame i has (length - i % 3) / 3 amino acids.
+	
+	if ( length < 3 )
 	{
-		return 0;
+		return;
 	}
-	*/
-	char aa = '*';//0;
 	
-	switch (codon[0])
+	const uint8_t * codes = codonTables.codes[preserveCase ? 1 : 0];
+	
+	uint64_t codon = 0;
+	int run = 0; // valid bases ending here, up to 3
+	
+	int frame = 0;
+	uint64_t index = 0;
+	int frameRev = (length - 3) % 3;
+	uint64_t indexRev = (length - 3) / 3;
+	
+	for ( uint64_t i = 0; i < length; i++ )
 	{
-	case 'A':
-		switch (codon[1])
+		uint8_t code = codes[(unsigned char)seq[i]];
+		
+		if ( code > 3 )
 		{
-		case 'A':
-			switch (codon[2])
-			{
-				case 'A': aa = 'K'; break;
-				case 'C': aa = 'N'; break;
-				case 'G': aa = 'K'; break;
-				case 'T': aa = 'N'; break;
-			}
-			break;
-		case 'C':
-			switch (codon[2])
-			{
-				case 'A': aa = 'T'; break;
-				case 'C': aa = 'T'; break;
-				case 'G': aa = 'T'; break;
-				case 'T': aa = 'T'; break;
-			}
-			break;
-		case 'G':
-			switch (codon[2])
-			{
-				case 'A': aa = 'R'; break;
-				case 'C': aa = 'S'; break;
-				case 'G': aa = 'R'; break;
-				case 'T': aa = 'S'; break;
-			}
-			break;
-		case 'T':
-			switch (codon[2])
-			{
-				case 'A': aa = 'I'; break;
-				case 'C': aa = 'I'; break;
-				case 'G': aa = 'M'; break;
-				case 'T': aa = 'I'; break;
-			}
-			break;
+			run = 0;
+			code = 0;
 		}
-		break;
-	case 'C':
-		switch (codon[1])
+		else if ( run < 3 )
 		{
-		case 'A':
-			switch (codon[2])
-			{
-				case 'A': aa = 'Q'; break;
-				case 'C': aa = 'H'; break;
-				case 'G': aa = 'Q'; break;
-				case 'T': aa = 'H'; break;
-			}
-			break;
-		case 'C':
-			switch (codon[2])
-			{
-				case 'A': aa = 'P'; break;
-				case 'C': aa = 'P'; break;
-				case 'G': aa = 'P'; break;
-				case 'T': aa = 'P'; break;
-			}
-			break;
-		case 'G':
-			switch (codon[2])
-			{
-				case 'A': aa = 'R'; break;
-				case 'C': aa = 'R'; break;
-				case 'G': aa = 'R'; break;
-				case 'T': aa = 'R'; break;
-			}
-			break;
-		case 'T':
-			switch (codon[2])
-			{
-				case 'A': aa = 'L'; break;
-				case 'C': aa = 'L'; break;
-				case 'G': aa = 'L'; break;
-				case 'T': aa = 'L'; break;
-			}
-			break;
+			run++;
 		}
-		break;
-	case 'G':
-		switch (codon[1])
+		
+		codon = (codon << 2 | code) & 63;
+		
+		if ( i < 2 )
 		{
-		case 'A':
-			switch (codon[2])
-			{
-				case 'A': aa = 'E'; break;
-				case 'C': aa = 'D'; break;
-				case 'G': aa = 'E'; break;
-				case 'T': aa = 'D'; break;
-			}
-			break;
-		case 'C':
-			switch (codon[2])
-			{
-				case 'A': aa = 'A'; break;
-				case 'C': aa = 'A'; break;
-				case 'G': aa = 'A'; break;
-				case 'T': aa = 'A'; break;
-			}
-			break;
-		case 'G':
-			switch (codon[2])
-			{
-				case 'A': aa = 'G'; break;
-				case 'C': aa = 'G'; break;
-				case 'G': aa = 'G'; break;
-				case 'T': aa = 'G'; break;
-			}
-			break;
-		case 'T':
-			switch (codon[2])
-			{
-				case 'A': aa = 'V'; break;
-				case 'C': aa = 'V'; break;
-				case 'G': aa = 'V'; break;
-				case 'T': aa = 'V'; break;
-			}
-			break;
+			continue;
 		}
-		break;
-	case 'T':
-		switch (codon[1])
+		
+		uint64_t codonValid = run == 3 ? codon : 64;
+		
+		frames[frame][index] = codonTables.aaForward[codonValid];
+		frames[3 + frameRev][indexRev] = codonTables.aaReverse[codonValid];
+		
+		if ( ++frame == 3 )
 		{
-		case 'A':
-			switch (codon[2])
-			{
-				case 'A': aa = '*'; break;
-				case 'C': aa = 'Y'; break;
-				case 'G': aa = '*'; break;
-				case 'T': aa = 'Y'; break;
-			}
-			break;
-		case 'C':
-			switch (codon[2])
-			{
-				case 'A': aa = 'S'; break;
-				case 'C': aa = 'S'; break;
-				case 'G': aa = 'S'; break;
-				case 'T': aa = 'S'; break;
-			}
-			break;
-		case 'G':
-			switch (codon[2])
-			{
-				case 'A': aa = '*'; break;
-				case 'C': aa = 'C'; break;
-				case 'G': aa = 'W'; break;
-				case 'T': aa = 'C'; break;
-			}
-			break;
-		case 'T':
-			switch (codon[2])
-			{
-				case 'A': aa = 'L'; break;
-				case 'C': aa = 'F'; break;
-				case 'G': aa = 'L'; break;
-				case 'T': aa = 'F'; break;
-			}
-			break;
+			frame = 0;
+			index++;
+		}
+		
+		if ( frameRev-- == 0 )
+		{
+			frameRev = 2;
+			indexRev--;
 		}
-		break;
 	}
-	
-	return aa;//(aa == '*') ? 0 : aa;
 }
 
 void useThreadOutput(CommandScreen::HashOutput * output, robin_hood::unordered_set<MinHashHeap *> & minHashHeaps)
@@ -29,74 +29,6 @@ struct HashTableEntry
 //typedef robin_hood::unordered_map< uint64_t, HashTableEntry > HashTable;
 typedef robin_hood::unordered_map< uint64_t, robin_hood::unordered_set<uint64_t> > HashTable;
 
-static const robin_hood::unordered_map< std::string, char > codons =
-{
-	{"AAA",	'K'},
-	{"AAC",	'N'},
-	{"AAG",	'K'},
-	{"AAT",	'N'},
-	{"ACA",	'T'},
-	{"ACC",	'T'},
-	{"ACG",	'T'},
-	{"ACT",	'T'},
-	{"AGA",	'R'},
-	{"AGC",	'S'},
-	{"AGG",	'R'},
-	{"AGT",	'S'},
-	{"ATA",	'I'},
-	{"ATC",	'I'},
-	{"ATG",	'M'},
-	{"ATT",	'I'},
-	{"CAA",	'Q'},
-	{"CAC",	'H'},
-	{"CAG",	'Q'},
-	{"CAT",	'H'},
-	{"CCA",	'P'},
-	{"CCC",	'P'},
-	{"CCG",	'P'},
-	{"CCT",	'P'},
-	{"CGA",	'R'},
-	{"CGC",	'R'},
-	{"CGG",	'R'},
-	{"CGT",	'R'},
-	{"CTA",	'L'},
-	{"CTC",	'L'},
-	{"CTG",	'L'},
-	{"CTT",	'L'},
-	{"GAA",	'E'},
-	{"GAC",	'D'},
-	{"GAG",	'E'},
-	{"GAT",	'D'},
-	{"GCA",	'A'},
-	{"GCC",	'A'},
-	{"GCG",	'A'},
-	{"GCT",	'A'},
-	{"GGA",	'G'},
-	{"GGC",	'G'},
-	{"GGG",	'G'},
-	{"GGT",	'G'},
-	{"GTA",	'V'},
-	{"GTC",	'V'},
-	{"GTG",	'V'},
-	{"GTT",	'V'},
-	{"TAA",	'*'},
-	{"TAC",	'Y'},
-	{"TAG",	'*'},
-	{"TAT",	'Y'},
-	{"TCA",	'S'},
-	{"TCC",	'S'},
-	{"TCG",	'S'},
-	{"TCT",	'S'},
-	{"TGA",	'*'},
-	{"TGC",	'C'},
-	{"TGG",	'W'},
-	{"TGT",	'C'},
-	{"TTA",	'L'},
-	{"TTC",	'F'},
-	{"TTG",	'L'},
-	{"TTT",	'F'}
-};
-
 class CommandScreen : public Command
 {
 public:
@@ -159,11 +91,12 @@ private:
 	};
 };
 
-char aaFromCodon(const char * codon);
 double estimateIdentity(uint64_t common, uint64_t denom, int kmerSize, double kmerSpace);
 CommandScreen::HashOutput * hashSequence(CommandScreen::HashInput * input);
+void insertHash(CommandScreen::HashInput * input, hash_u hash);
+void insertHashes(CommandScreen::HashInput * input, const char * const * kmers, int count);
 double pValueWithin(uint64_t x, uint64_t setSize, double kmerSpace, uint64_t sketchSize);
-void translate(const char * src, char * dst, uint64_t len);
+void translateFrames(const char * seq, uint64_t length, bool preserveCase, char * frames[6]);
 void useThreadOutput(CommandScreen::HashOutput * output, robin_hood::unordered_set<MinHashHeap *> & minHashHeaps);
 
 } // namespace mash
@@ -6,6 +6,7 @@
 
 #include "CommandSketch.h"
 #include "Sketch.h"
+#include "hashPacking.h"
 #include "sketchParameterSetup.h"
 #include <iostream>
 
@@ -27,6 +28,8 @@ CommandSketch::CommandSketch()
     useOption("help");
     addOption("list", Option(Option::Boolean, "l", "Input", "List input. Lines in each <input> specify paths to sequence files, one per line.", ""));
     addOption("prefix", Option(Option::File, "o", "Output", "Output prefix (first input file used if unspecified). The suffix '.msh' will be appended.", ""));
+    addOption("segment", Option(Option::Size, "B", "Output", "Write the sketch file in segments of about this size (raw bytes or with K/M/G/T) as sketches are made, rather than holding all of them until the end. Segmented files are rejected as malformed by versions of Mash that predate this option. Incompatible with -I and -C.", ""));
+    addOption("pack", Option(Option::Boolean, "P", "Output", "Pack hashes as bit-packed deltas for a smaller file. Packed sketch files are rejected as malformed by versions of Mash that predate this option.", ""));
     addOption("id", Option(Option::File, "I", "Sketch", "ID field for sketch of reads (instead of first sequence ID).", ""));
     addOption("comment", Option(Option::File, "C", "Sketch", "Comment for a sketch of reads (instead of first sequence comment).", ""));
     useSketchOptions();
@@ -50,6 +53,22 @@ int CommandSketch::run() const
     	return 1;
     }
     
+    if ( options.at("pack").active )
+    {
+    	parameters.hashEncoding = hashEncodingVersion;
+    }
+    
+    if ( options.at("segment").active )
+    {
+    	if ( options.at("id").active || options.at("comment").active )
+    	{
+    		cerr << "ERROR: The option -B cannot be used with -I or -C." << endl;
+    		return 1;
+    	}
+    	
+    	parameters.segmentSize = options.at("segment").getArgumentAsNumber();
+    }
+    
     for ( int i = 0; i < arguments.size(); i++ )
     {
         if ( false && hasSuffix(arguments[i], suffixSketch) )
@@ -89,6 +108,36 @@ int CommandSketch::run() const
     	}
     }
     
+    string prefix;
+    
+    if ( options.at("prefix").argument.length() > 0 )
+    {
+        prefix = options.at("prefix").argument;
+    }
+    else
+    {
+        if ( arguments[0] == "-" )
+        {
+            prefix = "stdin";
+        }
+        else
+        {
+            prefix = arguments[0];
+        }
+    }
+    
+    string suffix = parameters.windowed ? suffixSketchWindowed : suffixSketch;
+    
+    if ( ! hasSuffix(prefix, suffix) )
+    {
+        prefix += suffix;
+    }
+    
+    if ( parameters.segmentSize )
+    {
+    	sketch.setSegmentFile(prefix);
+    }
+    
     if ( parameters.reads )
     {
     	sketch.initFromReads(files, parameters);
@@ -128,34 +177,16 @@ int CommandSketch::run() const
 		}
 	}
 	
-    string prefix;
+    cerr << "Writing to " << prefix << "..." << endl;
     
-    if ( options.at("prefix").argument.length() > 0 )
+    if ( parameters.segmentSize )
     {
-        prefix = options.at("prefix").argument;
+    	sketch.finishSegments();
     }
     else
     {
-        if ( arguments[0] == "-" )
-        {
-            prefix = "stdin";
-        }
-        else
-        {
-            prefix = arguments[0];
-        }
-    }
-    
-    string suffix = parameters.windowed ? suffixSketchWindowed : suffixSketch;
-    
-    if ( ! hasSuffix(prefix, suffix) )
-    {
-        prefix += suffix;
-    }
-    
-    cerr << "Writing to " << prefix << "..." << endl;
-    
-    sketch.writeToCapnp(prefix.c_str());
+	    sketch.writeToCapnp(prefix.c_str());
+	}
     
     if ( warningCount > 0 && ! parameters.reads )
     {
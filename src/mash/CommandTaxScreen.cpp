@@ -7,6 +7,7 @@
 #include "CommandTaxScreen.h"
 #include "CommandDistance.h" // for pvalue
 #include "Sketch.h"
+#include "SketchManifest.h"
 #include "kseq.h"
 #include "taxdb.hpp"
 #include <iostream>
@@ -62,9 +63,9 @@ int CommandTaxScreen::run() const
 		return 0;
 	}
 
-	if ( ! hasSuffix(arguments[0], suffixSketch) )
+	if ( ! hasSuffix(arguments[0], suffixSketch) && ! isManifest(arguments[0]) )
 	{
-		cerr << "ERROR: " << arguments[0] << " does not look like a sketch (.msh)" << endl;
+		cerr << "ERROR: " << arguments[0] << " does not look like a sketch (.msh) or sketch manifest (.mshm)" << endl;
 		exit(1);
 	}
 
@@ -80,6 +81,8 @@ int CommandTaxScreen::run() const
 
 	Sketch sketch;
     Sketch::Parameters parameters;
+    
+    parameters.mapped = true;
 
     sketch.initFromFiles(refArgVector, parameters);
 
@@ -93,6 +96,7 @@ int CommandTaxScreen::run() const
 	parameters.use64 = sketch.getUse64();
 	parameters.preserveCase = sketch.getPreserveCase();
 	parameters.seed = sketch.getHashSeed();
+	parameters.hashFunction = sketch.getHashFunction();
 	parameters.minHashesPerWindow = sketch.getMinHashesPerWindow();
 
 	HashTable hashTable;
@@ -174,7 +178,7 @@ int CommandTaxScreen::run() const
         // for each hash a reference has
 		for ( int j = 0; j < hashes.size(); j++ )
 		{
-			uint64_t hash = hashes.get64() ? hashes.at(j).hash64 : hashes.at(j).hash32;
+			uint64_t hash = hashes.get64() ? hashes.data<hash64_t>()[j] : hashes.data<hash32_t>()[j];
 
 			if ( hashTable.count(hash) == 0 )
 			{
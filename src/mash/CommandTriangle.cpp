@@ -39,6 +39,8 @@ CommandTriangle::CommandTriangle()
     addOption("pvalue", Option(Option::Number, "v", "Output", "Maximum p-value to report in edge list. Implies -" + getOption("edge").identifier + ".", "1.0", 0., 1.));
     addOption("distance", Option(Option::Number, "d", "Output", "Maximum distance to report in edge list. Implies -" + getOption("edge").identifier + ".", "1.0", 0., 1.));
     //addOption("log", Option(Option::Boolean, "L", "Output", "Log scale distances and divide by k-mer size to provide a better analog to phylogenetic distance. The special case of zero shared min-hashes will result in a distance of 1.", ""));
+    useOption("cascade");
+    useOption("cascadeProb");
     useSketchOptions();
 }
 
@@ -71,6 +73,8 @@ int CommandTriangle::run() const
     	return 1;
     }
     
+    parameters.mapped = true;
+    
     if ( arguments.size() == 1 && !list )
     {
     	parameters.concatenated = false;
@@ -120,6 +124,19 @@ int CommandTriangle::run() const
 		}
 	}
     
+    CascadeScreen cascade;
+    
+    if ( options.at("cascade").active )
+    {
+        if ( distanceMax >= 1 )
+        {
+            cerr << "ERROR: The option -" << options.at("cascade").identifier << " requires a maximum distance (-" << options.at("distance").identifier << ") below 1." << endl;
+            return 1;
+        }
+        
+        setCascadeScreen(cascade, options.at("cascade").getArgumentAsNumber(), distanceMax, sketch.getKmerSize(), options.at("cascadeProb").getArgumentAsNumber());
+    }
+    
     if ( !edge )
     {
         cout << '\t' << sketch.getReferenceCount() << endl;
@@ -130,7 +147,7 @@ int CommandTriangle::run() const
     
     for ( uint64_t i = 1; i < sketch.getReferenceCount(); i++ )
     {
-        threadPool.runWhenThreadAvailable(new TriangleInput(sketch, i, parameters, distanceMax, pValueMax));
+        threadPool.runWhenThreadAvailable(new TriangleInput(sketch, i, parameters, distanceMax, pValueMax, options.at("cascade").active ? &cascade : 0));
         
         while ( threadPool.outputAvailable() )
         {
@@ -207,7 +224,7 @@ CommandTriangle::TriangleOutput * compare(CommandTriangle::TriangleInput * input
     
     for ( uint64_t i = 0; i < input->index; i++ )
     {
-        compareSketches(&output->pairs[i], sketch.getReference(input->index), sketch.getReference(i), sketchSize, sketch.getKmerSize(), sketch.getKmerSpace(), input->maxDistance, input->maxPValue);
+        compareSketches(&output->pairs[i], sketch.getReference(input->index), sketch.getReference(i), sketchSize, sketch.getKmerSize(), sketch.getKmerSpace(), input->maxDistance, input->maxPValue, input->cascade);
     }
     
     return output;
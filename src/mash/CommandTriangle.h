@@ -19,13 +19,14 @@ public:
     
     struct TriangleInput
     {
-        TriangleInput(const Sketch & sketchNew, uint64_t indexNew, const Sketch::Parameters & parametersNew, double maxDistanceNew, double maxPValueNew)
+        TriangleInput(const Sketch & sketchNew, uint64_t indexNew, const Sketch::Parameters & parametersNew, double maxDistanceNew, double maxPValueNew, const CascadeScreen * cascadeNew)
             :
             sketch(sketchNew),
             index(indexNew),
             parameters(parametersNew),
             maxDistance(maxDistanceNew),
-            maxPValue(maxPValueNew)
+            maxPValue(maxPValueNew),
+            cascade(cascadeNew)
             {}
         
         const Sketch & sketch;
@@ -33,6 +34,7 @@ public:
         const Sketch::Parameters & parameters;
         double maxDistance;
         double maxPValue;
+        const CascadeScreen * cascade;
     };
     
     struct TriangleOutput
@@ -6,6 +6,87 @@
 
 #include "HashList.h"
 #include <algorithm>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+HashList::HashList(const HashList & other)
+{
+    use64 = other.use64;
+    view = false;
+    hashes = 0;
+    count = 0;
+    capacity = 0;
+    
+    *this = other;
+}
+
+HashList::HashList(HashList && other)
+{
+    use64 = other.use64;
+    view = other.view;
+    hashes = other.hashes;
+    count = other.count;
+    capacity = other.capacity;
+    
+    other.hashes = 0;
+    other.count = 0;
+    other.capacity = 0;
+}
+
+HashList::~HashList()
+{
+    if ( ! view )
+    {
+        free(hashes);
+    }
+}
+
+HashList & HashList::operator=(const HashList & other)
+{
+    if ( this != &other && other.view )
+    {
+        setUse64(other.use64);
+        setView(other.hashes, other.count);
+    }
+    else if ( this != &other )
+    {
+        clear();
+        setUse64(other.use64);
+        reserve(other.count);
+        count = other.count;
+        
+        if ( count )
+        {
+            memcpy(hashes, other.hashes, count * width());
+        }
+    }
+    
+    return *this;
+}
+
+HashList & HashList::operator=(HashList && other)
+{
+    if ( this != &other )
+    {
+        if ( ! view )
+        {
+            free(hashes);
+        }
+        
+        use64 = other.use64;
+        view = other.view;
+        hashes = other.hashes;
+        count = other.count;
+        capacity = other.capacity;
+        
+        other.hashes = 0;
+        other.count = 0;
+        other.capacity = 0;
+    }
+    
+    return *this;
+}
 
 hash_u HashList::at(int index) const
 {
@@ -13,11 +94,11 @@ hash_u HashList::at(int index) const
     
     if ( use64 )
     {
-        hash.hash64 = hashes64.at(index);
+        hash.hash64 = data<hash64_t>()[index];
     }
     else
     {
-        hash.hash32 = hashes32.at(index);
+        hash.hash32 = data<hash32_t>()[index];
     }
     
     return hash;
@@ -25,46 +106,109 @@ hash_u HashList::at(int index) const
 
 void HashList::clear()
 {
-    if ( use64 )
+    if ( view )
     {
-        hashes64.clear();
+        view = false;
+        hashes = 0;
+        capacity = 0;
     }
-    else
+    
+    count = 0;
+}
+
+void HashList::reserve(int capacityNew)
+{
+    // capacity is counted in hashes of the current width
+    
+    if ( capacityNew <= capacity && ! view )
+    {
+        return;
+    }
+    
+    if ( capacityNew < count )
+    {
+        capacityNew = count;
+    }
+    
+    void * hashesNew = realloc(view ? 0 : hashes, (size_t)capacityNew * width());
+    
+    if ( hashesNew == 0 && capacityNew != 0 )
+    {
+        throw std::bad_alloc();
+    }
+    
+    if ( view )
     {
-        hashes32.clear();
+        // take a copy of the viewed hashes before changing them
+        
+        if ( count )
+        {
+            memcpy(hashesNew, hashes, (size_t)count * width());
+        }
+        
+        view = false;
     }
+    
+    hashes = hashesNew;
+    capacity = capacityNew;
 }
 
 void HashList::resize(int size)
 {
-    if ( use64 )
-    {
-        hashes64.resize(size);
-    }
-    else
+    reserve(size);
+    
+    if ( size > count )
     {
-        hashes32.resize(size);
+        memset((char *)hashes + (size_t)count * width(), 0, (size_t)(size - count) * width());
     }
+    
+    count = size;
 }
 
-void HashList::set32(int index, uint32_t value)
+void HashList::setUse64(bool use64New)
 {
-    hashes32[index] = value;
+    if ( use64New != use64 && view )
+    {
+        clear();
+    }
+    
+    if ( use64New != use64 )
+    {
+        // capacity is in hashes of the old width
+        
+        capacity = capacity * width() / (use64New ? sizeof(hash64_t) : sizeof(hash32_t));
+        count = 0;
+        use64 = use64New;
+    }
 }
 
-void HashList::set64(int index, uint64_t value)
+void HashList::setView(const void * hashesNew, int countNew)
 {
-    hashes64[index] = value;
+    if ( ! view )
+    {
+        free(hashes);
+    }
+    
+    view = true;
+    hashes = (void *)hashesNew;
+    count = countNew;
+    capacity = countNew;
 }
 
 void HashList::sort()
 {
+    if ( view )
+    {
+        reserve(count);
+    }
+    
+    
     if ( use64 )
     {
-        std::sort(hashes64.begin(), hashes64.end());
+        std::sort(data<hash64_t>(), data<hash64_t>() + count);
     }
     else
     {
-        std::sort(hashes32.begin(), hashes32.end());
+        std::sort(data<hash32_t>(), data<hash32_t>() + count);
     }
 }
@@ -10,30 +10,75 @@
 #include "hash.h"
 #include <vector>
 
+// A list of 32- or 64-bit hashes in one buffer of the width chosen by use64.
+// Inner loops should branch on get64() once and use data<hash32_t>() or
+// data<hash64_t>() rather than at().
+//
+// The list can also be a read-only view of hashes owned elsewhere (e.g. a
+// mapped sketch file), set with setView(). Copies of a view are views of the
+// same hashes; anything that modifies the list copies them first.
+//
 class HashList
 {
 public:
+
+    HashList() : use64(true), view(false), hashes(0), count(0), capacity(0) {}
+    HashList(bool use64new) : use64(use64new), view(false), hashes(0), count(0), capacity(0) {}
+    HashList(const HashList & other);
+    HashList(HashList && other);
+    ~HashList();
     
-    HashList() {use64 = true;}
-    HashList(bool use64new) {use64 = use64new;}
+    HashList & operator=(const HashList & other);
+    HashList & operator=(HashList && other);
     
     hash_u at(int index) const;
     void clear();
+    template<typename T> T * data() {if ( view ) reserve(count); return (T *)hashes;}
+    template<typename T> const T * data() const {return (const T *)hashes;}
+    const hash32_t * data32() const {return data<hash32_t>();}
+    const hash64_t * data64() const {return data<hash64_t>();}
     void resize(int size);
-    void set32(int index, uint32_t value);
-    void set64(int index, uint64_t value);
-    void setUse64(bool use64New) {use64 = use64New;}
-    int size() const {return use64 ? hashes64.size() : hashes32.size();}
+    void set32(int index, uint32_t value) {data<hash32_t>()[index] = value;}
+    void set64(int index, uint64_t value) {data<hash64_t>()[index] = value;}
+    void setUse64(bool use64New); // must be empty
+    void setView(const void * hashesNew, int countNew);
+    int size() const {return count;}
     void sort();
-    void push_back32(hash32_t hash) {hashes32.push_back(hash);}
-    void push_back64(hash64_t hash) {hashes64.push_back(hash);}
+    void push_back32(hash32_t hash);
+    void push_back64(hash64_t hash);
     bool get64() const {return use64;}
-    
+    bool isView() const {return view;}
+
 private:
+
+    void reserve(int capacityNew);
+    int width() const {return use64 ? sizeof(hash64_t) : sizeof(hash32_t);}
     
     bool use64;
-    std::vector<hash32_t> hashes32;
-    std::vector<hash64_t> hashes64;
+    bool view;
+    void * hashes;
+    int count;
+    int capacity;
 };
 
+inline void HashList::push_back32(hash32_t hash)
+{
+    if ( count == capacity )
+    {
+        reserve(capacity ? capacity * 2 : 16);
+    }
+    
+    data<hash32_t>()[count++] = hash;
+}
+
+inline void HashList::push_back64(hash64_t hash)
+{
+    if ( count == capacity )
+    {
+        reserve(capacity ? capacity * 2 : 16);
+    }
+    
+    data<hash64_t>()[count++] = hash;
+}
+
 #endif
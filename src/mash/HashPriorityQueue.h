@@ -10,22 +10,22 @@
 #include "hash.h"
 #include <queue>
 
+// Max-heap of hashes of type T (hash32_t or hash64_t)
+//
+template <typename T>
 class HashPriorityQueue
 {
 public:
 	
-	HashPriorityQueue(bool use64New) : use64(use64New) {}
-	void clear();
-	void pop() {use64 ? queue64.pop() : queue32.pop();}
-	void push(hash_u hash) {use64 ? queue64.push(hash.hash64) : queue32.push(hash.hash32);}
-	int size() const {return use64 ? queue64.size() : queue32.size();}
-	hash_u top() const;
+	void clear() {queue = std::priority_queue<T>();}
+	void pop() {queue.pop();}
+	void push(T hash) {queue.push(hash);}
+	int size() const {return queue.size();}
+	T top() const {return queue.top();}
 	
 private:
     
-	bool use64;
-	std::priority_queue<hash32_t> queue32;
-	std::priority_queue<hash64_t> queue64;
+	std::priority_queue<T> queue;
 };
 
 #endif
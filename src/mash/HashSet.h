@@ -11,25 +11,57 @@
 #include "robin_hood.h"
 #include <vector>
 
+// Counts of hashes of type T (hash32_t or hash64_t)
+//
+template <typename T>
 class HashSet
 {
 public:
-
-    HashSet(bool use64New) : use64(use64New) {}
     
-    int size() const {return use64 ? hashes64.size() : hashes32.size();}
-    void clear() {use64 ? hashes64.clear() : hashes32.clear();}
-    uint32_t count(hash_u hash) const;
-    void erase(hash_u hash);
-    void insert(hash_u hash, uint32_t count = 1);
+    int size() const {return hashes.size();}
+    void clear() {hashes.clear();}
+    uint32_t count(T hash) const;
+    void erase(T hash) {hashes.erase(hash);}
+    void insert(T hash, uint32_t count = 1) {hashes[hash] += count;}
     void toHashList(HashList & hashList) const;
     void toCounts(std::vector<uint32_t> & counts) const;
     
 private:
     
-    bool use64;
-    robin_hood::unordered_map<hash32_t, uint32_t> hashes32;
-    robin_hood::unordered_map<hash64_t, uint32_t> hashes64;
+    robin_hood::unordered_map<T, uint32_t> hashes;
 };
 
+template <typename T>
+uint32_t HashSet<T>::count(T hash) const
+{
+    auto i = hashes.find(hash);
+    
+    return i == hashes.end() ? 0 : i->second;
+}
+
+template <typename T>
+void HashSet<T>::toCounts(std::vector<uint32_t> & counts) const
+{
+    for ( auto i = hashes.begin(); i != hashes.end(); i++ )
+    {
+        counts.push_back(i->second);
+    }
+}
+
+template <typename T>
+void HashSet<T>::toHashList(HashList & hashList) const
+{
+    int size = hashList.size();
+    
+    hashList.setUse64(sizeof(T) == sizeof(hash64_t));
+    hashList.resize(size + hashes.size());
+    
+    T * data = hashList.data<T>() + size;
+    
+    for ( auto i = hashes.begin(); i != hashes.end(); i++ )
+    {
+        *data++ = i->first;
+    }
+}
+
 #endif
@@ -0,0 +1,115 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#include "HashSortedArray.h"
+#include <algorithm>
+
+HashSortedArray::HashSortedArray(uint64_t capacityNew)
+{
+	capacity = capacityNew;
+	
+	// a buffer as large as the array keeps merging amortized O(log k) per hash
+	// without letting small sketches merge too often
+	//
+	bufferSize = capacity < 1024 ? 1024 : capacity;
+	
+	buffer.reserve(bufferSize);
+}
+
+void HashSortedArray::clear()
+{
+	hashes.clear();
+	counts.clear();
+	buffer.clear();
+}
+
+void HashSortedArray::merge() const
+{
+	if ( buffer.size() == 0 )
+	{
+		return;
+	}
+	
+	std::sort(buffer.begin(), buffer.end());
+	
+	hashesMerged.clear();
+	countsMerged.clear();
+	
+	uint64_t i = 0;
+	uint64_t j = 0;
+	
+	while ( hashesMerged.size() < capacity && (i < hashes.size() || j < buffer.size()) )
+	{
+		uint64_t hash;
+		uint32_t count = 0;
+		
+		if ( j == buffer.size() || (i < hashes.size() && hashes[i] <= buffer[j]) )
+		{
+			hash = hashes[i];
+			count = counts[i];
+			i++;
+		}
+		else
+		{
+			hash = buffer[j];
+		}
+		
+		// buffered copies of the hash add to its count
+		
+		while ( j < buffer.size() && buffer[j] == hash )
+		{
+			count++;
+			j++;
+		}
+		
+		hashesMerged.push_back(hash);
+		countsMerged.push_back(count);
+	}
+	
+	hashes.swap(hashesMerged);
+	counts.swap(countsMerged);
+	buffer.clear();
+}
+
+uint64_t HashSortedArray::sumCounts() const
+{
+	merge();
+	
+	uint64_t sum = 0;
+	
+	for ( uint64_t i = 0; i < counts.size(); i++ )
+	{
+		sum += counts[i];
+	}
+	
+	return sum;
+}
+
+void HashSortedArray::toCounts(std::vector<uint32_t> & countsOut) const
+{
+	merge();
+	countsOut.insert(countsOut.end(), counts.begin(), counts.end());
+}
+
+void HashSortedArray::toHashList(HashList & hashList, bool use64) const
+{
+	merge();
+	
+	if ( use64 )
+	{
+		for ( uint64_t i = 0; i < hashes.size(); i++ )
+		{
+			hashList.push_back64(hashes[i]);
+		}
+	}
+	else
+	{
+		for ( uint64_t i = 0; i < hashes.size(); i++ )
+		{
+			hashList.push_back32(hashes[i]);
+		}
+	}
+}
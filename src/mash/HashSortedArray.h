@@ -0,0 +1,66 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#ifndef HashSortedArray_h
+#define HashSortedArray_h
+
+#include "HashList.h"
+#include <vector>
+
+// The smallest (up to) capacity distinct hashes seen, with their counts, kept
+// in flat sorted arrays. Insertions go to a buffer, which is sorted and merged
+// in when it fills (or when the contents are read), so each hash costs a
+// push_back plus its share of a linear merge rather than a hash map insert
+// and a heap push. 32-bit hashes are stored widened to 64 bits.
+//
+class HashSortedArray
+{
+public:
+
+    HashSortedArray(uint64_t capacityNew);
+    
+    void clear();
+    
+    // returns true if the buffer was merged, which may lower maximum()
+    //
+    bool insert(uint64_t hash);
+    
+    uint64_t maximum() const {merge(); return hashes.back();}
+    uint64_t size() const {merge(); return hashes.size();}
+    uint64_t sumCounts() const;
+    void toCounts(std::vector<uint32_t> & countsOut) const;
+    void toHashList(HashList & hashList, bool use64) const;
+
+private:
+
+    void merge() const;
+    
+    uint64_t capacity;
+    uint64_t bufferSize;
+    
+    // reading merges the buffer, so the contents are mutable
+    //
+    mutable std::vector<uint64_t> hashes;
+    mutable std::vector<uint32_t> counts;
+    mutable std::vector<uint64_t> buffer;
+    mutable std::vector<uint64_t> hashesMerged;
+    mutable std::vector<uint32_t> countsMerged;
+};
+
+inline bool HashSortedArray::insert(uint64_t hash)
+{
+	buffer.push_back(hash);
+	
+	if ( buffer.size() < bufferSize )
+	{
+		return false;
+	}
+	
+	merge();
+	return true;
+}
+
+#endif
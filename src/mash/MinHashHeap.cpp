@@ -4,12 +4,13 @@
 
 using namespace::std;
 
-MinHashHeap::MinHashHeap(bool use64New, uint64_t cardinalityMaximumNew, uint64_t multiplicityMinimumNew, uint64_t memoryBoundBytes) :
+MinHashHeap::MinHashHeap(bool use64New, uint64_t cardinalityMaximumNew, uint64_t multiplicityMinimumNew, uint64_t memoryBoundBytes, bool countingNew) :
 	use64(use64New),
-	hashes(use64New),
-	hashesQueue(use64New),
-	hashesPending(use64New),
-	hashesQueuePending(use64New)
+	counting(countingNew),
+	sorted(! countingNew && multiplicityMinimumNew <= 1 && memoryBoundBytes == 0),
+	hashesSorted(cardinalityMaximumNew),
+	full(false),
+	threshold(0)
 {
 	cardinalityMaximum = cardinalityMaximumNew;
 	multiplicityMinimum = multiplicityMinimumNew;
@@ -52,17 +53,17 @@ MinHashHeap::~MinHashHeap()
 void MinHashHeap::computeStats()
 {
 	vector<uint32_t> counts;
-	hashes.toCounts(counts);
+	toCounts(counts);
 	
-	HashList hashList;
-	hashes.toHashList(hashList);
+	HashList hashList(use64);
+	toHashList(hashList);
 	
 	//cout<<"counts size:  "<<counts.size()<<endl;
 	//cout<< "hashlist index size:  "<<hashList.size()<<endl;
 	int j = 0;
 	for ( int i = 0, j = 0; i < counts.size(), j < hashList.size(); i++ ,j++)
 	{
-		cout<< hashList.at(j).hash64<<"   ";
+		cout<< (use64 ? hashList.at(j).hash64 : hashList.at(j).hash32)<<"   ";
 		cout << counts.at(i) << endl;
 	}
 	
@@ -70,11 +71,10 @@ void MinHashHeap::computeStats()
 
 void MinHashHeap::clear()
 {
-	hashes.clear();
-	hashesQueue.clear();
+	hashesSorted.clear();
 	
-	hashesPending.clear();
-	hashesQueuePending.clear();
+	sets32 = MinHashSets<hash32_t>();
+	sets64 = MinHashSets<hash64_t>();
 	
 	if ( bloomFilter != 0 )
 	{
@@ -82,87 +82,171 @@ void MinHashHeap::clear()
 	}
 	
 	multiplicitySum = 0;
+	full = false;
 }
 
-void MinHashHeap::tryInsert(hash_u hash)
+double MinHashHeap::estimateMultiplicity() const
 {
-	hashes.insert(hash, 1);
-	if(hashes.count(hash) == 0)
+	if ( sorted )
 	{
-		hashesQueue.push(hash);
+		return hashesSorted.size() ? (double)hashesSorted.sumCounts() / hashesSorted.size() : 0;
 	}
-	/*
-	if(hashes.size() < cardinalityMaximum ||hashLessThan(hash, hashesQueue.top(), use64))
+	
+	return setSize() ? (double)multiplicitySum / setSize() : 0;
+}
+
+double MinHashHeap::estimateSetSize() const
+{
+	uint64_t size = sorted ? hashesSorted.size() : setSize();
+	
+	if ( size == 0 )
+	{
+		return 0;
+	}
+	
+	double maximum = sorted ? hashesSorted.maximum() : use64 ? sets64.hashesQueue.top() : sets32.hashesQueue.top();
+	
+	return pow(2.0, use64 ? 64.0 : 32.0) * (double)size / maximum;
+}
+
+void MinHashHeap::insertBounded(hash_u hash)
+{
+	// tryInsert has already checked the hash is below the threshold (if full)
+	
+	if ( sorted )
 	{
-		if ( hashes.count(hash) == 0 )
+		if ( hashesSorted.insert(use64 ? hash.hash64 : hash.hash32) )
 		{
-			if ( bloomFilter != 0 )
-			{
-                		const unsigned char * data = use64 ? (const unsigned char *)&hash.hash64 : (const unsigned char *)&hash.hash32;
-            			size_t length = use64 ? 8 : 4;
+			updateThreshold();
+		}
+		
+		return;
+	}
+	
+	if ( use64 )
+	{
+		insertBounded(hash.hash64, sets64);
+	}
+	else
+	{
+		insertBounded(hash.hash32, sets32);
+	}
+	
+	updateThreshold();
+}
+
+template <typename T>
+void MinHashHeap::insertBounded(T hash, MinHashSets<T> & sets)
+{
+	if ( sets.hashes.count(hash) == 0 )
+	{
+		if ( bloomFilter != 0 )
+		{
+                		const unsigned char * data = (const unsigned char *)&hash;
+            			size_t length = sizeof(T);
             	
                 		if ( bloomFilter->contains(data, length) )
                 		{
-					hashes.insert(hash, 2);
-					hashesQueue.push(hash);
-					multiplicitySum += 2;
-	                		kmersUsed++;
+				sets.hashes.insert(hash, 2);
+				sets.hashesQueue.push(hash);
+				multiplicitySum += 2;
+                		kmersUsed++;
                			}
             			else
             			{
-	                		bloomFilter->insert(data, length);
-	                		kmersTotal++;
-	            		}
-			}
-			else if ( multiplicityMinimum == 1 || hashesPending.count(hash) == multiplicityMinimum - 1 )
-			{
-				hashes.insert(hash, multiplicityMinimum);
-				hashesQueue.push(hash);
-				multiplicitySum += multiplicityMinimum;
-				
-				if ( multiplicityMinimum > 1 )
-				{
-					// just remove from set for now; will be removed from
-					// priority queue when it's on top
-					//
-					hashesPending.erase(hash);
-				}
-			}
-			else
-			{
-				if ( hashesPending.count(hash) == 0 )
-				{
-					hashesQueuePending.push(hash);
-				}
+                		bloomFilter->insert(data, length);
+                		kmersTotal++;
+            		}
+		}
+		else if ( multiplicityMinimum == 1 || sets.hashesPending.count(hash) == multiplicityMinimum - 1 )
+		{
+			sets.hashes.insert(hash, multiplicityMinimum);
+			sets.hashesQueue.push(hash);
+			multiplicitySum += multiplicityMinimum;
 			
-				hashesPending.insert(hash, 1);
+			if ( multiplicityMinimum > 1 )
+			{
+				// just remove from set for now; will be removed from
+				// priority queue when it's on top
+				//
+				sets.hashesPending.erase(hash);
 			}
 		}
 		else
 		{
-			hashes.insert(hash, 1);
-			multiplicitySum++;
+			if ( sets.hashesPending.count(hash) == 0 )
+			{
+				sets.hashesQueuePending.push(hash);
+			}
+			
+			sets.hashesPending.insert(hash, 1);
 		}
+	}
+	else
+	{
+		sets.hashes.insert(hash, 1);
+		multiplicitySum++;
+	}
+	
+	if ( sets.hashes.size() > cardinalityMaximum )
+	{
+		multiplicitySum -= sets.hashes.count(sets.hashesQueue.top());
+		sets.hashes.erase(sets.hashesQueue.top());
 		
-		if ( hashes.size() > cardinalityMaximum )
+		// loop since there could be zombie hashes (gone from hashesPending)
+		//
+		while ( sets.hashesQueuePending.size() > 0 && sets.hashesQueue.top() < sets.hashesQueuePending.top() )
 		{
-			multiplicitySum -= hashes.count(hashesQueue.top());
-			hashes.erase(hashesQueue.top());
-			
-			// loop since there could be zombie hashes (gone from hashesPending)
-			//
-			while ( hashesQueuePending.size() > 0 && hashLessThan(hashesQueue.top(), hashesQueuePending.top(), use64) )
+			if ( sets.hashesPending.count(sets.hashesQueuePending.top()) )
 			{
-				if ( hashesPending.count(hashesQueuePending.top()) )
-				{
-					hashesPending.erase(hashesQueuePending.top());
-				}
-				
-				hashesQueuePending.pop();
+				sets.hashesPending.erase(sets.hashesQueuePending.top());
 			}
 			
-			hashesQueue.pop();
+			sets.hashesQueuePending.pop();
 		}
+		
+		sets.hashesQueue.pop();
+	}
+}
+
+void MinHashHeap::insertCounting(hash_u hash)
+{
+	if ( use64 )
+	{
+		insertCounting(hash.hash64, sets64);
+	}
+	else
+	{
+		insertCounting(hash.hash32, sets32);
+	}
+}
+
+template <typename T>
+void MinHashHeap::insertCounting(T hash, MinHashSets<T> & sets)
+{
+	sets.hashes.insert(hash, 1);
+	if(sets.hashes.count(hash) == 0)
+	{
+		sets.hashesQueue.push(hash);
+	}
+}
+
+void MinHashHeap::updateThreshold()
+{
+	if ( sorted )
+	{
+		if ( hashesSorted.size() >= cardinalityMaximum && hashesSorted.size() > 0 )
+		{
+			full = true;
+			threshold = hashesSorted.maximum();
+		}
+		
+		return;
+	}
+	
+	if ( setSize() >= cardinalityMaximum && setSize() > 0 )
+	{
+		full = true;
+		threshold = use64 ? sets64.hashesQueue.top() : sets32.hashesQueue.top();
 	}
-	*/
 }
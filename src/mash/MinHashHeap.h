@@ -4,14 +4,31 @@
 #include "HashList.h"
 #include "HashPriorityQueue.h"
 #include "HashSet.h"
+#include "HashSortedArray.h"
 #include <math.h>
 #include "bloom_filter.hpp"
 
+// The sets and queues used when filtering by multiplicity or counting, for
+// one hash width
+//
+template <typename T>
+struct MinHashSets
+{
+	HashSet<T> hashes;
+	HashPriorityQueue<T> hashesQueue;
+	
+	HashSet<T> hashesPending;
+	HashPriorityQueue<T> hashesQueuePending;
+};
+
 class MinHashHeap
 {
 public:
 
-	MinHashHeap(bool use64New, uint64_t cardinalityMaximumNew, uint64_t multiplicityMinimumNew = 1, uint64_t memoryBoundBytes = 0);
+	// If countingNew is true, every hash is kept and counted (for k-mer
+	// statistics); otherwise only the bottom cardinalityMaximumNew are kept.
+	//
+	MinHashHeap(bool use64New, uint64_t cardinalityMaximumNew, uint64_t multiplicityMinimumNew = 1, uint64_t memoryBoundBytes = 0, bool countingNew = false);
 	~MinHashHeap();
 	void computeStats();
 	void clear();
@@ -23,13 +40,31 @@ public:
 
 private:
 
+	void insertBounded(hash_u hash);
+	template <typename T> void insertBounded(T hash, MinHashSets<T> & sets);
+	void insertCounting(hash_u hash);
+	template <typename T> void insertCounting(T hash, MinHashSets<T> & sets);
+	int setSize() const {return use64 ? sets64.hashes.size() : sets32.hashes.size();}
+	void updateThreshold();
+	
 	bool use64;
+	bool counting;
+	
+	// Without a multiplicity filter, the bottom-k is kept in a sorted array
+	// rather than the sets and queues.
+	//
+	bool sorted;
+	HashSortedArray hashesSorted;
 	
-	HashSet hashes;
-	HashPriorityQueue hashesQueue;
+	// Once the heap holds cardinalityMaximum hashes, only hashes below the
+	// current maximum (cached here) can change it, so the rest are rejected
+	// without touching the sets.
+	//
+	bool full;
+	uint64_t threshold;
 	
-	HashSet hashesPending;
-	HashPriorityQueue hashesQueuePending;
+	MinHashSets<hash32_t> sets32;
+	MinHashSets<hash64_t> sets64;
 	
 	uint64_t cardinalityMaximum;
 	uint64_t multiplicityMinimum;
@@ -42,9 +77,19 @@ private:
     uint64_t kmersUsed;
 };
 
-inline double MinHashHeap::estimateMultiplicity() const {return hashes.size() ? (double)multiplicitySum / hashes.size() : 0;}
-inline double MinHashHeap::estimateSetSize() const {return hashes.size() ? pow(2.0, use64 ? 64.0 : 32.0) * (double)hashes.size() / (use64 ? (double)hashesQueue.top().hash64 : (double)hashesQueue.top().hash32) : 0;}
-inline void MinHashHeap::toHashList(HashList & hashList) const {hashes.toHashList(hashList);}
-inline void MinHashHeap::toCounts(std::vector<uint32_t> & counts) const {hashes.toCounts(counts);}
+inline void MinHashHeap::toHashList(HashList & hashList) const {sorted ? hashesSorted.toHashList(hashList, use64) : use64 ? sets64.hashes.toHashList(hashList) : sets32.hashes.toHashList(hashList);}
+inline void MinHashHeap::toCounts(std::vector<uint32_t> & counts) const {sorted ? hashesSorted.toCounts(counts) : use64 ? sets64.hashes.toCounts(counts) : sets32.hashes.toCounts(counts);}
+
+inline void MinHashHeap::tryInsert(hash_u hash)
+{
+	if ( counting )
+	{
+		insertCounting(hash);
+	}
+	else if ( ! full || (use64 ? hash.hash64 : hash.hash32) < threshold )
+	{
+		insertBounded(hash);
+	}
+}
 
 #endif
@@ -13,14 +13,21 @@
 #include <map>
 #include "kseq.h"
 #include "MurmurHash3.h"
+#include <algorithm>
 #include <assert.h>
 #include <queue>
 #include <deque>
 #include <set>
 #include "Command.h" // TEMP for column printing
+#include "cpuDispatch.h"
+#include "hashPacking.h"
+#include "ntHash.h"
+#include "SketchManifest.h"
 #include <sys/stat.h>
+#include <capnp/any.h>
 #include <capnp/message.h>
 #include <capnp/serialize.h>
+#include <kj/exception.h>
 #include <sys/mman.h>
 #include <math.h>
 #include <list>
@@ -34,6 +41,160 @@ using namespace std;
 
 typedef map < Sketch::hash_t, vector<Sketch::PositionHash> > LociByHash_map;
 
+// Hash lists in sketch files are little-endian, so they can only be viewed in
+// place on little-endian hosts.
+//
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	static const bool canViewMappedHashes = true;
+#else
+	static const bool canViewMappedHashes = false;
+#endif
+
+// Files that versions predating packed hashes or segments would misread start
+// with this word. As a message header it claims ~4 billion segments, so those versions
+// fail to parse the file rather than reading it as empty; mapCapnp skips it.
+//
+static const unsigned char fileMarker[8] = {0xfe, 0xff, 0xff, 0xff, 'm', 's', 'h', '2'};
+
+static bool hasFileMarker(const void * data, uint64_t size)
+{
+	return size >= sizeof(fileMarker) && memcmp(data, fileMarker, sizeof(fileMarker)) == 0;
+}
+
+static bool writeAll(int fd, const void * data, uint64_t size)
+{
+	const char * bytes = (const char *)data;
+	
+	while ( size > 0 )
+	{
+		ssize_t written = write(fd, bytes, size);
+		
+		if ( written <= 0 )
+		{
+			return false;
+		}
+		
+		bytes += written;
+		size -= written;
+	}
+	
+	return true;
+}
+
+// Each mapping costs a VMA, of which processes get ~65k by default, so only
+// files big enough for copying to matter stay mapped; the hashes of smaller
+// ones are copied and the file unmapped after loading.
+//
+static const uint64_t mappedFileSizeMin = 1 << 20;
+
+static bool keepMapped(const Sketch::Parameters & parameters, const Sketch::MappedFile & mappedFile)
+{
+	return parameters.mapped && canViewMappedHashes && mappedFile.size >= mappedFileSizeMin;
+}
+
+Sketch::MappedFile::~MappedFile()
+{
+	for ( uint64_t i = 0; i < messages.size(); i++ )
+	{
+		delete messages[i];
+	}
+	
+	munmap(data, size);
+}
+
+int Sketch::appendToCapnp(const char * file) const
+{
+    // Appends the references as a new segment. A file that is not segmented
+    // yet becomes the first segment, copied as is after a new header; after
+    // that, appending only writes the new references.
+    
+    if ( references.size() == 0 )
+    {
+        return 0;
+    }
+    
+    shared_ptr<MappedFile> mappedFile(mapCapnp(file));
+    
+    if ( ! mappedFile )
+    {
+        cerr << "ERROR: could not open \"" << file << "\" for reading." << endl;
+        exit(1);
+    }
+    
+    // the new segment is built before anything is written, and a failed
+    // write is undone, so the file is never left ending in part of a message
+    //
+    capnp::MallocMessageBuilder message;
+    writeToCapnpBuilder(message.initRoot<capnp::MinHash>(), 0, references.size());
+    kj::Array<capnp::word> segment = capnp::messageToFlatArray(message);
+    
+    string fileTemp = string(file) + ".tmp";
+    bool convert = mappedFile->firstSegment == 0;
+    int fd = convert ? open(fileTemp.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644) : open(file, O_WRONLY | O_APPEND);
+    
+    if ( fd < 0 )
+    {
+        cerr << "ERROR: could not open " << (convert ? fileTemp : file) << " for writing.\n";
+        exit(1);
+    }
+    
+    // drop anything after the last whole message, left by an append that was
+    // killed, which would otherwise hide the new segment
+    //
+    off_t sizeBefore = (const char *)mappedFile->messages.back()->getEnd() - (const char *)mappedFile->data;
+    bool success = convert || ftruncate(fd, sizeBefore) == 0;
+    
+    if ( convert )
+    {
+        capnp::MallocMessageBuilder messageHeader;
+        capnp::MinHash::Builder builder = messageHeader.initRoot<capnp::MinHash>();
+        
+        writeToCapnpBuilder(builder, 0, 0);
+        builder.setSegmented(true);
+        
+        kj::Array<capnp::word> header = capnp::messageToFlatArray(messageHeader);
+        const char * bytes = (const char *)mappedFile->data;
+        
+        if ( hasFileMarker(mappedFile->data, mappedFile->size) )
+        {
+            bytes += sizeof(fileMarker);
+        }
+        
+        success =
+            writeAll(fd, fileMarker, sizeof(fileMarker)) &&
+            writeAll(fd, header.begin(), header.size() * sizeof(capnp::word)) &&
+            writeAll(fd, bytes, (const char *)mappedFile->messages[0]->getEnd() - bytes);
+    }
+    
+    success = success && writeAll(fd, segment.begin(), segment.size() * sizeof(capnp::word));
+    
+    if ( ! success )
+    {
+        if ( convert )
+        {
+            unlink(fileTemp.c_str());
+        }
+        else if ( ftruncate(fd, sizeBefore) != 0 )
+        {
+            cerr << "ERROR: could not write to " << file << ", and could not restore its size of " << sizeBefore << " bytes.\n";
+            exit(1);
+        }
+        
+        cerr << "ERROR: could not write to " << (convert ? fileTemp : file) << ".\n";
+        exit(1);
+    }
+    
+    close(fd);
+    
+    if ( convert && rename(fileTemp.c_str(), file) != 0 )
+    {
+        cerr << "ERROR: could not replace " << file << " with " << fileTemp << ".\n";
+        exit(1);
+    }
+    
+    return 0;
+}
+
 void Sketch::getAlphabetAsString(string & alphabet) const
 {
 	for ( int i = 0; i < 256; i++ )
@@ -93,6 +254,56 @@ uint64_t Sketch::getReferenceIndex(string id) const
     }
 }
 
+int Sketch::initFromCapnpById(const char * file, const vector<string> & ids, const Parameters & parametersNew)
+{
+    parameters = parametersNew;
+	
+	shared_ptr<MappedFile> mappedFile(mapCapnp(file));
+	
+	if ( ! mappedFile )
+	{
+        cerr << "ERROR: could not open \"" << file << "\" for reading." << endl;
+        exit(1);
+	}
+    
+    initParametersFromCapnp(*mappedFile, file);
+    
+    Parameters parametersLoad = parameters;
+    parametersLoad.mapped = keepMapped(parameters, *mappedFile);
+    
+    for ( int i = 0; i < ids.size(); i++ )
+    {
+    	bool found = false;
+    	
+    	for ( uint64_t j = 0; j < mappedFile->getSegmentCount() && ! found; j++ )
+    	{
+		    capnp::MinHash::ReferenceList::Reader referenceListReader = getReferenceListReader(mappedFile->getSegment(j));
+	    	uint64_t index = findReferenceInCapnp(referenceListReader, ids[i]);
+	    	
+	    	if ( index != -1 )
+	    	{
+		    	references.resize(references.size() + 1);
+		    	loadReferenceFromCapnp(referenceListReader.getReferences()[index], references.back(), parametersLoad);
+		    	found = true;
+		    }
+	    }
+    	
+    	if ( ! found )
+    	{
+    		cerr << "WARNING: The sketch " << ids[i] << " was not found in " << file << "." << endl;
+    	}
+    }
+    
+    if ( parametersLoad.mapped )
+    {
+    	mappedFiles.push_back(mappedFile);
+    }
+    
+    createIndex();
+    
+    return 0;
+}
+
 void Sketch::initFromReads(const vector<string> & files, const Parameters & parametersNew)
 {
     parameters = parametersNew;
@@ -102,8 +313,38 @@ void Sketch::initFromReads(const vector<string> & files, const Parameters & para
     createIndex();
 }
 
-int Sketch::initFromFiles(const vector<string> & files, const Parameters & parametersNew, int verbosity, bool enforceParameters, bool contain)
+int Sketch::initFromFiles(const vector<string> & filesAndManifests, const Parameters & parametersNew, int verbosity, bool enforceParameters, bool contain)
 {
+	// load manifests as their shards, which the thread pool loads in parallel
+	// like any other files, remembering each shard's manifest to check it
+	//
+	vector<string> files;
+	list<SketchManifest> manifests;
+	vector<const SketchManifest *> manifestByFile;
+	vector<uint64_t> shardByFile;
+	
+	for ( int i = 0; i < filesAndManifests.size(); i++ )
+	{
+		if ( isManifest(filesAndManifests[i]) )
+		{
+			manifests.push_back(SketchManifest());
+			manifests.back().read(filesAndManifests[i]);
+			
+			for ( uint64_t j = 0; j < manifests.back().shards.size(); j++ )
+			{
+				files.push_back(manifests.back().shards[j].file);
+				manifestByFile.push_back(&manifests.back());
+				shardByFile.push_back(j);
+			}
+		}
+		else
+		{
+			files.push_back(filesAndManifests[i]);
+			manifestByFile.push_back(0);
+			shardByFile.push_back(0);
+		}
+	}
+    
     parameters = parametersNew;
     
 	ThreadPool<Sketch::SketchInput, Sketch::SketchOutput> threadPool(0, parameters.parallelism);
@@ -114,14 +355,29 @@ int Sketch::initFromFiles(const vector<string> & files, const Parameters & param
         
         if ( isSketch )
         {
+			// map once, for checking the header and for loading
+			//
+            shared_ptr<MappedFile> mappedFile(mapCapnp(files[i].c_str()));
+            
+            if ( ! mappedFile )
+            {
+                cerr << "ERROR: could not open \"" << files[i] << "\" for reading." << endl;
+                exit(1);
+            }
+			
 			// init header to check params
 			//
 			Sketch sketchTest;
-			sketchTest.initParametersFromCapnp(files[i].c_str());
+			uint64_t referenceCountTest = sketchTest.initParametersFromCapnp(*mappedFile, files[i].c_str());
+			
+			if ( manifestByFile[i] )
+			{
+				manifestByFile[i]->checkShard(shardByFile[i], sketchTest, referenceCountTest);
+			}
 			
         	if ( i == 0 && ! enforceParameters )
         	{
-        		initParametersFromCapnp(files[i].c_str());
+        		initParametersFromCapnp(*mappedFile, files[i].c_str());
         	}
         	
             string alphabet;
@@ -141,6 +397,13 @@ int Sketch::initFromFiles(const vector<string> & files, const Parameters & param
 				cerr << "\nWARNING: The sketch " << files[i] << " has a seed size (" << sketchTest.getHashSeed() << ") that does not match the current seed (" << parameters.seed << "). This file will be skipped." << endl << endl;
 				continue;
             }
+            
+            if ( sketchTest.getHashFunction() != parameters.hashFunction )
+            {
+				cerr << "\nWARNING: The sketch " << files[i] << " uses a hash function (" << getHashFunctionName(sketchTest.getHashFunction()) << ") that does not match the current hash function (" << getHashFunctionName(parameters.hashFunction) << "). This file will be skipped." << endl << endl;
+				continue;
+            }
+			
 			if ( sketchTest.getKmerSize() != parameters.kmerSize )
 			{
 				cerr << "\nWARNING: The sketch " << files[i] << " has a kmer size (" << sketchTest.getKmerSize() << ") that does not match the current kmer size (" << parameters.kmerSize << "). This file will be skipped." << endl << endl;
@@ -164,11 +427,44 @@ int Sketch::initFromFiles(const vector<string> & files, const Parameters & param
                 cerr << "\nWARNING: The sketch file " << files[i] << " has a target sketch size (" << sketchTest.getMinHashesPerWindow() << ") that is larger than the current sketch size (" << parameters.minHashesPerWindow << "). Its sketches will be reduced." << endl << endl;
             }
             
-            // init fully
+            // init fully, in ranges of each segment's references that share one
+            // mapping, so a single large file can be decoded by every thread
             //
             vector<string> file;
             file.push_back(files[i]);
-			threadPool.runWhenThreadAvailable(new SketchInput(file, 0, 0, "", "", parameters), loadCapnp);
+            
+            for ( uint64_t j = 0; j < mappedFile->getSegmentCount(); j++ )
+            {
+	            uint64_t referenceCount = getReferenceListReader(mappedFile->getSegment(j)).getReferences().size();
+	            uint64_t rangeSize = referenceCount;
+	            
+	            if ( parameters.parallelism > 1 )
+	            {
+	            	rangeSize = (referenceCount + parameters.parallelism * 4 - 1) / (parameters.parallelism * 4);
+	            	
+	            	if ( rangeSize < 1024 )
+	            	{
+	            		rangeSize = 1024;
+	            	}
+	            }
+	            
+	            for ( uint64_t start = 0; start < referenceCount; start += rangeSize )
+	            {
+	            	SketchInput * input = new SketchInput(file, 0, 0, "", "", parameters);
+	            	
+	            	input->segment = j;
+	            	input->referenceStart = start;
+	            	input->referenceEnd = start + rangeSize;
+	            	input->mappedFile = mappedFile;
+					
+					threadPool.runWhenThreadAvailable(input, loadCapnp);
+					
+					while ( threadPool.outputAvailable() )
+					{
+						useThreadOutput(threadPool.popOutputWhenAvailable());
+					}
+				}
+			}
         }
         else
 		{
@@ -254,40 +550,20 @@ int Sketch::initFromFiles(const vector<string> & files, const Parameters & param
 
 uint64_t Sketch::initParametersFromCapnp(const char * file)
 {
-    int fd = open(file, O_RDONLY);
+    shared_ptr<MappedFile> mappedFile(mapCapnp(file));
     
-    if ( fd < 0 )
+    if ( ! mappedFile )
     {
         cerr << "ERROR: could not open \"" << file << "\" for reading." << endl;
         exit(1);
     }
     
-    struct stat fileInfo;
-    
-    if ( stat(file, &fileInfo) == -1 )
-    {
-        cerr << "ERROR: could not get file stats for \"" << file << "\"." << endl;
-        exit(1);
-    }
-    
-    void * data = mmap(NULL, fileInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
-    
-    if (data == MAP_FAILED)
-    {
-        uint64_t fileSize = fileInfo.st_size;
-        std::cerr << "Error: could not memory-map file " << file << " of size " << fileSize;
-        std::cerr << std::endl;
-        exit(1);
-    }
+    return initParametersFromCapnp(*mappedFile, file);
+}
 
-    capnp::ReaderOptions readerOptions;
-    
-    readerOptions.traversalLimitInWords = 1000000000000;
-    readerOptions.nestingLimit = 1000000;
-    
-    //capnp::StreamFdMessageReader * message = new capnp::StreamFdMessageReader(fd, readerOptions);
-    capnp::FlatArrayMessageReader * message = new capnp::FlatArrayMessageReader(kj::ArrayPtr<const capnp::word>(reinterpret_cast<const capnp::word *>(data), fileInfo.st_size / sizeof(capnp::word)), readerOptions);
-    capnp::MinHash::Reader reader = message->getRoot<capnp::MinHash>();
+uint64_t Sketch::initParametersFromCapnp(const MappedFile & mappedFile, const char * file)
+{
+    capnp::MinHash::Reader reader = mappedFile.getHeader();
     
     parameters.kmerSize = reader.getKmerSize();
     parameters.error = reader.getError();
@@ -297,11 +573,29 @@ uint64_t Sketch::initParametersFromCapnp(const char * file)
     parameters.noncanonical = reader.getNoncanonical();
    	parameters.preserveCase = reader.getPreserveCase();
 
-    capnp::MinHash::ReferenceList::Reader referenceListReader = reader.getReferenceList().getReferences().size() ? reader.getReferenceList() : reader.getReferenceListOld();
-    capnp::List<capnp::MinHash::ReferenceList::Reference>::Reader referencesReader = referenceListReader.getReferences();
-    uint64_t referenceCount = referencesReader.size();
+    uint64_t referenceCount = 0;
+    
+    for ( uint64_t i = 0; i < mappedFile.getSegmentCount(); i++ )
+    {
+    	referenceCount += getReferenceListReader(mappedFile.getSegment(i)).getReferences().size();
+    }
     
    	parameters.seed = reader.getHashSeed();
+   	parameters.hashFunction = HashFunction(reader.getHashFunction());
+   	
+   	if ( parameters.hashFunction > hashFunctionNtHash )
+   	{
+   		cerr << "ERROR: " << file << " uses an unknown hash function (" << parameters.hashFunction << "). It may have been created by a newer version of Mash." << endl;
+   		exit(1);
+   	}
+   	
+   	parameters.hashEncoding = reader.getHashEncoding();
+   	
+   	if ( parameters.hashEncoding > hashEncodingVersion )
+   	{
+   		cerr << "ERROR: " << file << " uses an unknown hash encoding (" << parameters.hashEncoding << "). It may have been created by a newer version of Mash." << endl;
+   		exit(1);
+   	}
     
     if ( reader.hasAlphabet() )
     {
@@ -311,13 +605,6 @@ uint64_t Sketch::initParametersFromCapnp(const char * file)
     {
     	setAlphabetFromString(parameters, alphabetNucleotide);
     }
-	close(fd);
-	
-	try
-	{
-		delete message;
-	}
-	catch (exception e) {}
 	
 	return referenceCount;
 }
@@ -370,16 +657,116 @@ bool Sketch::sketchFileBySequence(FILE * file, ThreadPool<Sketch::SketchInput, S
 
 void Sketch::useThreadOutput(SketchOutput * output)
 {
-	references.insert(references.end(), output->references.begin(), output->references.end());
-	positionHashesByReference.insert(positionHashesByReference.end(), output->positionHashesByReference.begin(), output->positionHashesByReference.end());
+	if ( output->mappedFile && (mappedFiles.empty() || mappedFiles.back() != output->mappedFile) )
+	{
+		mappedFiles.push_back(output->mappedFile);
+	}
+	
+	// moved rather than copied, since this runs on the main thread while
+	// others decode
+	//
+	references.insert(references.end(), make_move_iterator(output->references.begin()), make_move_iterator(output->references.end()));
+	positionHashesByReference.insert(positionHashesByReference.end(), make_move_iterator(output->positionHashesByReference.begin()), make_move_iterator(output->positionHashesByReference.end()));
+	
+	if ( segmentFile.size() && parameters.segmentSize )
+	{
+		for ( uint64_t i = 0; i < output->references.size(); i++ )
+		{
+			const Reference & reference = references[references.size() - 1 - i];
+			
+			segmentBytes += reference.name.size() + reference.comment.size() + reference.hashesSorted.size() * (parameters.use64 ? 8 : 4) + reference.counts.size() * 4;
+		}
+		
+		if ( segmentBytes >= parameters.segmentSize )
+		{
+			writeSegment();
+		}
+	}
+	
 	delete output;
 }
 
+void Sketch::writeSegment()
+{
+    if ( segmentFd < 0 )
+    {
+        segmentFd = open(segmentFile.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+        
+        if ( segmentFd < 0 )
+        {
+            cerr << "ERROR: could not open " << segmentFile << " for writing.\n";
+            exit(1);
+        }
+        
+        // the marker makes versions that predate segments reject the file,
+        // rather than read the header, which has no references, as empty
+        //
+        capnp::MallocMessageBuilder message;
+        capnp::MinHash::Builder builder = message.initRoot<capnp::MinHash>();
+        
+        writeToCapnpBuilder(builder, 0, 0);
+        builder.setSegmented(true);
+        
+        if ( ! writeAll(segmentFd, fileMarker, sizeof(fileMarker)) )
+        {
+            cerr << "ERROR: could not write to " << segmentFile << ".\n";
+            exit(1);
+        }
+        
+        writeMessageToFd(segmentFd, message);
+    }
+    
+    capnp::MallocMessageBuilder message;
+    writeToCapnpBuilder(message.initRoot<capnp::MinHash>(), segmentStart, references.size());
+    writeMessageToFd(segmentFd, message);
+    
+    // keep what is needed for reporting, but not hashes
+    
+    for ( uint64_t i = segmentStart; i < references.size(); i++ )
+    {
+        references[i].hashesSorted = HashList(parameters.use64);
+        vector<uint32_t>().swap(references[i].counts);
+        
+        if ( i < positionHashesByReference.size() )
+        {
+            vector<PositionHash>().swap(positionHashesByReference[i]);
+        }
+    }
+    
+    segmentStart = references.size();
+    segmentBytes = 0;
+}
+
+void Sketch::finishSegments()
+{
+    // write what is left (or the whole file, if no segment was full)
+    
+    if ( segmentFd < 0 || segmentStart < references.size() )
+    {
+        writeSegment();
+    }
+    
+    close(segmentFd);
+    segmentFd = -1;
+}
+
 bool Sketch::writeToFile() const
 {
     return writeToCapnp(file.c_str()) == 0;
 }
 
+struct ReferenceNameLess
+{
+	ReferenceNameLess(const Sketch::Reference * referencesNew) : references(referencesNew) {}
+	
+	bool operator()(uint32_t a, uint32_t b) const
+	{
+		return strcmp(references[a].name.c_str(), references[b].name.c_str()) < 0;
+	}
+	
+	const Sketch::Reference * references;
+};
+
 int Sketch::writeToCapnp(const char * file) const
 {
     int fd = open(file, O_CREAT | O_WRONLY | O_TRUNC, 0644);
@@ -391,15 +778,39 @@ int Sketch::writeToCapnp(const char * file) const
     }
     
     capnp::MallocMessageBuilder message;
-    capnp::MinHash::Builder builder = message.initRoot<capnp::MinHash>();
+    writeToCapnpBuilder(message.initRoot<capnp::MinHash>(), 0, references.size());
     
-    capnp::MinHash::ReferenceList::Builder referenceListBuilder = (parameters.seed == 42 ? builder.initReferenceListOld() : builder.initReferenceList());
+    if ( parameters.hashEncoding != 0 && ! writeAll(fd, fileMarker, sizeof(fileMarker)) )
+    {
+        cerr << "ERROR: could not write to " << file << ".\n";
+        exit(1);
+    }
     
-    capnp::List<capnp::MinHash::ReferenceList::Reference>::Builder referencesBuilder = referenceListBuilder.initReferences(references.size());
+    writeMessageToFd(fd, message);
+    close(fd);
     
-    for ( uint64_t i = 0; i < references.size(); i++ )
+    return 0;
+}
+
+void Sketch::writeToCapnpBuilder(capnp::MinHash::Builder builder, uint64_t start, uint64_t end) const
+{
+    // Only default sketches go in the old list, so versions that predate seeds
+    // and hash functions can't read the others as if they were default. Packed
+    // sketches get their own list, so they are never read as sketches without
+    // hashes (files of them also start with fileMarker).
+    //
+    capnp::MinHash::ReferenceList::Builder referenceListBuilder =
+        parameters.hashEncoding != 0 ? builder.initReferenceListPacked() :
+        parameters.seed == 42 && parameters.hashFunction == hashFunctionMurmur3 ? builder.initReferenceListOld() :
+        builder.initReferenceList();
+    
+    vector<uint8_t> packed;
+    
+    capnp::List<capnp::MinHash::ReferenceList::Reference>::Builder referencesBuilder = referenceListBuilder.initReferences(end - start);
+    
+    for ( uint64_t i = start; i < end; i++ )
     {
-        capnp::MinHash::ReferenceList::Reference::Builder referenceBuilder = referencesBuilder[i];
+        capnp::MinHash::ReferenceList::Reference::Builder referenceBuilder = referencesBuilder[i - start];
         
         referenceBuilder.setName(references[i].name);
         referenceBuilder.setComment(references[i].comment);
@@ -409,22 +820,31 @@ int Sketch::writeToCapnp(const char * file) const
         {
             const HashList & hashes = references[i].hashesSorted;
             
-            if ( parameters.use64 )
+            if ( parameters.hashEncoding != 0 )
+            {
+                packHashes(hashes, packed);
+                memcpy(referenceBuilder.initHashesPacked(packed.size()).begin(), packed.data(), packed.size());
+            }
+            else if ( parameters.use64 )
             {
                 capnp::List<uint64_t>::Builder hashes64Builder = referenceBuilder.initHashes64(hashes.size());
             
+                const hash64_t * hashes64 = hashes.data<hash64_t>();
+                
                 for ( uint64_t j = 0; j != hashes.size(); j++ )
                 {
-                    hashes64Builder.set(j, hashes.at(j).hash64);
+                    hashes64Builder.set(j, hashes64[j]);
                 }
             }
             else
             {
                 capnp::List<uint32_t>::Builder hashes32Builder = referenceBuilder.initHashes32(hashes.size());
             
+                const hash32_t * hashes32 = hashes.data<hash32_t>();
+                
                 for ( uint64_t j = 0; j != hashes.size(); j++ )
                 {
-                    hashes32Builder.set(j, hashes.at(j).hash32);
+                    hashes32Builder.set(j, hashes32[j]);
                 }
             }
             
@@ -442,9 +862,29 @@ int Sketch::writeToCapnp(const char * file) const
         }
     }
     
+    // indices sorted by name, so single sketches can be found without
+    // reading every name
+    //
+    vector<uint32_t> indicesByName(end - start);
+    
+    for ( uint64_t i = 0; i < indicesByName.size(); i++ )
+    {
+        indicesByName[i] = i;
+    }
+    
+    std::stable_sort(indicesByName.begin(), indicesByName.end(), ReferenceNameLess(references.data() + start));
+    
+    capnp::List<uint32_t>::Builder nameIndexBuilder = referenceListBuilder.initNameIndex(end - start);
+    
+    for ( uint64_t i = 0; i < indicesByName.size(); i++ )
+    {
+        nameIndexBuilder.set(i, indicesByName[i]);
+    }
+    
+    uint64_t locusEnd = end < positionHashesByReference.size() ? end : positionHashesByReference.size();
     int locusCount = 0;
     
-    for ( int i = 0; i < positionHashesByReference.size(); i++ )
+    for ( uint64_t i = start; i < locusEnd; i++ )
     {
         locusCount += positionHashesByReference.at(i).size();
     }
@@ -454,14 +894,14 @@ int Sketch::writeToCapnp(const char * file) const
     
     int locusIndex = 0;
     
-    for ( int i = 0; i < positionHashesByReference.size(); i++ )
+    for ( uint64_t i = start; i < locusEnd; i++ )
     {
         for ( int j = 0; j < positionHashesByReference.at(i).size(); j++ )
         {
             capnp::MinHash::LocusList::Locus::Builder locusBuilder = lociBuilder[locusIndex];
             locusIndex++;
             
-            locusBuilder.setSequence(i);
+            locusBuilder.setSequence(i - start);
             locusBuilder.setPosition(positionHashesByReference.at(i).at(j).position);
             locusBuilder.setHash64(positionHashesByReference.at(i).at(j).hash);
         }
@@ -469,6 +909,8 @@ int Sketch::writeToCapnp(const char * file) const
     
     builder.setKmerSize(parameters.kmerSize);
     builder.setHashSeed(parameters.seed);
+    builder.setHashFunction(capnp::MinHash::HashFunction(parameters.hashFunction));
+    builder.setHashEncoding(parameters.hashEncoding);
     builder.setError(parameters.error);
     builder.setMinHashesPerWindow(parameters.minHashesPerWindow);
     builder.setWindowSize(parameters.windowSize);
@@ -479,11 +921,6 @@ int Sketch::writeToCapnp(const char * file) const
     string alphabet;
     getAlphabetAsString(alphabet);
     builder.setAlphabet(alphabet);
-    
-    writeMessageToFd(fd, message);
-    close(fd);
-    
-    return 0;
 }
 
 void Sketch::createIndex()
@@ -502,81 +939,348 @@ void Sketch::createIndex()
             lociByHash[positionHash.hash].push_back(Locus(i, positionHash.position));
         }
     }
-    
-    kmerSpace = pow(parameters.alphabetSize, parameters.kmerSize);
+    
+    kmerSpace = pow(parameters.alphabetSize, parameters.kmerSize);
+}
+
+// 2-bit codes of upper case nucleotides (A=0, C=1, G=2, T=3), which sort in
+// the same order as their characters, so packed k-mers compare the same way
+// memcmp would compare the strings. Everything else is invalid.
+//
+static const uint8_t nucleotideInvalid = 4;
+//
+struct NucleotideCodes
+{
+	NucleotideCodes()
+	{
+		const char chars[] = {'A', 'C', 'G', 'T'};
+		
+		memset(codes, nucleotideInvalid, 256);
+		
+		for ( int i = 0; i < 4; i++ )
+		{
+			codes[chars[i]] = i;
+		}
+		
+		// every packed byte (4 bases) to its characters, for decoding
+		//
+		for ( int i = 0; i < 256; i++ )
+		{
+			for ( int j = 0; j < 4; j++ )
+			{
+				chars4[i][j] = chars[(i >> (6 - 2 * j)) & 3];
+			}
+		}
+	}
+	
+	uint8_t codes[256];
+	char chars4[256][4];
+};
+//
+static const NucleotideCodes nucleotideCodes;
+
+bool hasNucleotideEncoding(const Sketch::Parameters & parameters)
+{
+	// The rolling 2-bit path needs the plain ACGT alphabet and k-mers that
+	// fit in one word; anything else goes through the string path.
+	
+	return
+		! parameters.noncanonical &&
+		parameters.kmerSize <= 32 &&
+		parameters.alphabetSize == 4 &&
+		parameters.alphabet['A'] &&
+		parameters.alphabet['C'] &&
+		parameters.alphabet['G'] &&
+		parameters.alphabet['T'];
+}
+
+void insertHashes(MinHashHeap & minHashHeap, const char * const * kmers, int count, const Sketch::Parameters & parameters)
+{
+	hash_u hashes[hashBatchSize];
+	
+	getHashes(kmers, count, parameters.kmerSize, parameters.seed, parameters.use64, hashes);
+	
+	for ( int i = 0; i < count; i++ )
+	{
+		minHashHeap.tryInsert(hashes[i]);
+	}
+}
+
+template <int kmerSizeFixed>
+void addMinHashesNucleotide(MinHashHeap & minHashHeap, const char * seq, uint64_t length, const Sketch::Parameters & parameters)
+{
+	// Keep the forward k-mer and its reverse complement as rolling 2-bit
+	// words, so the canonical strand is picked with one compare rather than
+	// a memcmp against a reverse complemented copy of the sequence. Hashes
+	// are still taken over the characters of the canonical k-mer, so they
+	// match those of the string path. A nonzero kmerSizeFixed makes the masks
+	// and decoding loop compile-time constants.
+	
+	const int kmerSize = kmerSizeFixed ? kmerSizeFixed : parameters.kmerSize;
+	uint64_t mask = kmerSize == 32 ? ~uint64_t(0) : (uint64_t(1) << (2 * kmerSize)) - 1;
+	int shift = 2 * (kmerSize - 1);
+	
+	uint64_t fwd = 0;
+	uint64_t rev = 0;
+	int valid = 0; // length of current run of valid characters (up to k)
+	
+	// k-mers are hashed in batches; decoded reverse k-mers end at the end of
+	// their slot, with the front as padding so whole bytes can be decoded
+	//
+	const char * kmers[hashBatchSize];
+	char kmerRevs[hashBatchSize][32];
+	int batch = 0;
+	
+	for ( uint64_t i = 0; i < length; i++ )
+	{
+		uint64_t code = nucleotideCodes.codes[(unsigned char)seq[i]];
+		
+		if ( code == nucleotideInvalid )
+		{
+			valid = 0;
+			continue;
+		}
+		
+		fwd = ((fwd << 2) | code) & mask;
+		rev = (rev >> 2) | ((3 - code) << shift);
+		
+		if ( valid < kmerSize )
+		{
+			valid++;
+			
+			if ( valid < kmerSize )
+			{
+				continue;
+			}
+		}
+		
+		const char * kmer;
+		
+		if ( fwd <= rev )
+		{
+			kmer = seq + i + 1 - kmerSize;
+		}
+		else
+		{
+			uint64_t packed = rev;
+			char * kmerRevEnd = kmerRevs[batch] + 32;
+			
+			for ( char * end = kmerRevEnd; end > kmerRevEnd - kmerSize; end -= 4 )
+			{
+				memcpy(end - 4, nucleotideCodes.chars4[packed & 0xff], 4);
+				packed >>= 8;
+			}
+			
+			kmer = kmerRevEnd - kmerSize;
+		}
+		
+		kmers[batch++] = kmer;
+		
+		if ( batch == hashBatchSize )
+		{
+			insertHashes(minHashHeap, kmers, batch, parameters);
+			batch = 0;
+		}
+	}
+	
+	insertHashes(minHashHeap, kmers, batch, parameters);
+}
+
+void addMinHashesRolling(MinHashHeap & minHashHeap, const char * seq, uint64_t length, const Sketch::Parameters & parameters)
+{
+	// ntHash updates in O(1) per base, so k-mers are hashed as they are rolled
+	
+	NtHash ntHash(parameters.kmerSize, parameters.seed, ! parameters.noncanonical);
+	hash_u hash;
+	
+	for ( uint64_t i = 0; i < length; i++ )
+	{
+		if ( ntHash.roll(seq, i) )
+		{
+			if ( parameters.use64 )
+			{
+				hash.hash64 = ntHash.hash();
+			}
+			else
+			{
+				hash.hash32 = ntHash.hash();
+			}
+			
+			minHashHeap.tryInsert(hash);
+		}
+	}
+}
+
+template <int kmerSizeFixed>
+void addMinHashesString(MinHashHeap & minHashHeap, char * seq, uint64_t length, const Sketch::Parameters & parameters)
+{
+    const int kmerSize = kmerSizeFixed ? kmerSizeFixed : parameters.kmerSize;
+    bool noncanonical = parameters.noncanonical;
+    
+    // uppercase and find valid characters in one pass
+    //
+    vector<uint64_t> valid((length + 63) / 64);
+    getCpuKernels().normalize(seq, length, ! parameters.preserveCase, parameters.alphabet, valid.data());
+    
+    char * seqRev;
+    
+    if ( ! noncanonical )
+    {
+    	seqRev = new char[length];
+        reverseComplement(seq, seqRev, length);
+    }
+    
+    const char * kmers[hashBatchSize];
+    int batch = 0;
+    
+    // hash the k-mers of each run of characters in the alphabet
+    //
+    for ( uint64_t start = findBit(valid.data(), 0, length, true); start + kmerSize <= length; )
+    {
+    	uint64_t end = findBit(valid.data(), start, length, false);
+		
+		for ( uint64_t i = start; i + kmerSize <= end; i++ )
+		{
+			const char *kmer_fwd = seq + i;
+			const char *kmer_rev = seqRev + length - i - kmerSize;
+			const char * kmer = (noncanonical || memcmp(kmer_fwd, kmer_rev, kmerSize) <= 0) ? kmer_fwd : kmer_rev;
+			
+			kmers[batch++] = kmer;
+			
+			if ( batch == hashBatchSize )
+			{
+				insertHashes(minHashHeap, kmers, batch, parameters);
+				batch = 0;
+			}
+		}
+		
+		start = findBit(valid.data(), end, length, true);
+    }
+    
+    insertHashes(minHashHeap, kmers, batch, parameters);
+    
+    if ( ! noncanonical )
+    {
+        delete [] seqRev;
+    }
+}
+
+void addMinHashes(MinHashHeap & minHashHeap, char * seq, uint64_t length, const Sketch::Parameters & parameters)
+{
+    // Determine the 'mins' smallest hashes, including those already provided
+    // (potentially replacing them). This allows min-hash sets across multiple
+    // sequences to be determined.
+    
+    if ( parameters.hashFunction == hashFunctionNtHash )
+    {
+    	if ( ! parameters.preserveCase )
+    	{
+    		getCpuKernels().uppercase(seq, length);
+    	}
+    	
+    	addMinHashesRolling(minHashHeap, seq, length, parameters);
+    	return;
+    }
+    
+    // k-mer extraction and hashing are specialized for common k-mer sizes
+    //
+    if ( hasNucleotideEncoding(parameters) )
+    {
+    	// uppercase TODO: alphabets?
+    	//
+    	if ( ! parameters.preserveCase )
+    	{
+    		getCpuKernels().uppercase(seq, length);
+    	}
+    	
+    	switch ( parameters.kmerSize )
+    	{
+    		case 15: addMinHashesNucleotide<15>(minHashHeap, seq, length, parameters); break;
+    		case 16: addMinHashesNucleotide<16>(minHashHeap, seq, length, parameters); break;
+    		case 21: addMinHashesNucleotide<21>(minHashHeap, seq, length, parameters); break;
+    		case 31: addMinHashesNucleotide<31>(minHashHeap, seq, length, parameters); break;
+    		case 32: addMinHashesNucleotide<32>(minHashHeap, seq, length, parameters); break;
+    		default: addMinHashesNucleotide<0>(minHashHeap, seq, length, parameters);
+    	}
+    }
+    else
+    {
+    	switch ( parameters.kmerSize )
+    	{
+    		case 15: addMinHashesString<15>(minHashHeap, seq, length, parameters); break;
+    		case 16: addMinHashesString<16>(minHashHeap, seq, length, parameters); break;
+    		case 21: addMinHashesString<21>(minHashHeap, seq, length, parameters); break;
+    		case 31: addMinHashesString<31>(minHashHeap, seq, length, parameters); break;
+    		case 32: addMinHashesString<32>(minHashHeap, seq, length, parameters); break;
+    		default: addMinHashesString<0>(minHashHeap, seq, length, parameters);
+    	}
+    }
 }
 
-void addMinHashes(MinHashHeap & minHashHeap, char * seq, uint64_t length, const Sketch::Parameters & parameters)
+uint64_t findReferenceInCapnp(capnp::MinHash::ReferenceList::Reader referenceListReader, const string & id)
 {
-    int kmerSize = parameters.kmerSize;
-    uint64_t mins = parameters.minHashesPerWindow;
-    bool noncanonical = parameters.noncanonical;
-    
-    // Determine the 'mins' smallest hashes, including those already provided
-    // (potentially replacing them). This allows min-hash sets across multiple
-    // sequences to be determined.
+    capnp::List<capnp::MinHash::ReferenceList::Reference>::Reader referencesReader = referenceListReader.getReferences();
+    capnp::List<uint32_t>::Reader nameIndexReader = referenceListReader.getNameIndex();
     
-    // uppercase TODO: alphabets?
-    //
-    for ( uint64_t i = 0; i < length; i++ )
+    if ( nameIndexReader.size() == referencesReader.size() )
     {
-        if ( ! parameters.preserveCase && seq[i] > 96 && seq[i] < 123 )
+        // binary search, reading only the names it lands on
+        
+        uint64_t low = 0;
+        uint64_t high = nameIndexReader.size();
+        
+        while ( low < high )
+        {
+            uint64_t middle = low + (high - low) / 2;
+            uint32_t index = nameIndexReader[middle];
+            
+            if ( index >= referencesReader.size() )
+            {
+                break; // corrupt index; scan instead
+            }
+            
+            if ( strcmp(referencesReader[index].getName().cStr(), id.c_str()) < 0 )
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        
+        if ( low < nameIndexReader.size() && nameIndexReader[low] < referencesReader.size() && referencesReader[nameIndexReader[low]].getName().cStr() == id )
+        {
+            return nameIndexReader[low];
+        }
+        
+        if ( low == high )
         {
-            seq[i] -= 32;
+            return -1;
         }
     }
     
-    char * seqRev;
+    // sketch files written before the name index
     
-    if ( ! noncanonical )
+    for ( uint64_t i = 0; i < referencesReader.size(); i++ )
     {
-    	seqRev = new char[length];
-        reverseComplement(seq, seqRev, length);
+        if ( referencesReader[i].getName().cStr() == id )
+        {
+            return i;
+        }
     }
     
-    uint64_t j = 0;
-    
-    for ( uint64_t i = 0; i < length - kmerSize + 1; i++ )
+    return -1;
+}
+
+capnp::MinHash::ReferenceList::Reader getReferenceListReader(capnp::MinHash::Reader reader)
+{
+    if ( reader.getHashEncoding() != 0 )
     {
-		// repeatedly skip kmers with bad characters
-		//
-		bool bad = false;
-		//
-		for ( ; j < i + kmerSize && i + kmerSize <= length; j++ )
-		{
-			if ( ! parameters.alphabet[seq[j]] )
-			{
-				i = j++; // skip to past the bad character
-				bad = true;
-				break;
-			}
-		}
-		//
-		if ( bad )
-		{
-			continue;
-		}
-		//	
-		if ( i + kmerSize > length )
-		{
-			// skipped to end
-			break;
-		}
-            
-        const char *kmer_fwd = seq + i;
-        const char *kmer_rev = seqRev + length - i - kmerSize;
-        const char * kmer = (noncanonical || memcmp(kmer_fwd, kmer_rev, kmerSize) <= 0) ? kmer_fwd : kmer_rev;
-        bool filter = false;
-        
-        hash_u hash = getHash(kmer, kmerSize, parameters.seed, parameters.use64);
-        
-		minHashHeap.tryInsert(hash);
+        return reader.getReferenceListPacked();
     }
     
-    if ( ! noncanonical )
-    {
-        delete [] seqRev;
-    }
+    return reader.getReferenceList().getReferences().size() ? reader.getReferenceList() : reader.getReferenceListOld();
 }
 
 void getMinHashPositions(vector<Sketch::PositionHash> & positionHashes, char * seq, uint32_t length, const Sketch::Parameters & parameters, int verbosity)
@@ -640,8 +1344,30 @@ void getMinHashPositions(vector<Sketch::PositionHash> & positionHashes, char * s
     
     int unique = 0;
     
+    // hashes are computed a batch at a time, ahead of the window
+    //
+    const char * kmers[hashBatchSize];
+    hash_u hashes[hashBatchSize];
+    
     for ( int i = 0; i < length - kmerSize + 1; i++ )
     {
+        if ( i % hashBatchSize == 0 )
+        {
+            int count = length - kmerSize + 1 - i;
+            
+            if ( count > hashBatchSize )
+            {
+                count = hashBatchSize;
+            }
+            
+            for ( int j = 0; j < count; j++ )
+            {
+                kmers[j] = seq + i + j;
+            }
+            
+            getHashes(kmers, count, kmerSize, parameters.seed, parameters.use64, hashes);
+        }
+        
         // Increment the next valid kmer if needed. Invalid kmers must still be
         // processed to keep the queue filled, but will be associated with a
         // dummy iterator. (Currently disabled to allow all kmers; see below)
@@ -677,7 +1403,7 @@ void getMinHashPositions(vector<Sketch::PositionHash> & positionHashes, char * s
         
         if ( i >= nextValidKmer )
         {
-            Sketch::hash_t hash = getHash(seq + i, kmerSize, parameters.seed, parameters.use64).hash64; // TODO: dynamic
+            Sketch::hash_t hash = hashes[i % hashBatchSize].hash64; // TODO: dynamic
             
             if ( verbosity > 1 )
             {
@@ -903,104 +1629,43 @@ bool hasSuffix(string const & whole, string const & suffix)
 
 Sketch::SketchOutput * loadCapnp(Sketch::SketchInput * input)
 {
-	const char * file = input->fileNames[0].c_str();
-    int fd = open(file, O_RDONLY);
-    
-    struct stat fileInfo;
-    
-    if ( stat(file, &fileInfo) == -1 )
-    {
-        return 0;
-    }
-    
+	shared_ptr<Sketch::MappedFile> mappedFile = input->mappedFile;
+	
+	if ( ! mappedFile )
+	{
+		mappedFile.reset(mapCapnp(input->fileNames[0].c_str()));
+	}
+	
+	if ( ! mappedFile )
+	{
+		return 0;
+	}
+	
 	Sketch::SketchOutput * output = new Sketch::SketchOutput();
 	vector<Sketch::Reference> & references = output->references;
 	
-    void * data = mmap(NULL, fileInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	Sketch::Parameters parameters = input->parameters;
+	parameters.mapped = keepMapped(input->parameters, *mappedFile);
     
-    capnp::ReaderOptions readerOptions;
+    capnp::MinHash::Reader reader = mappedFile->getSegment(input->segment);
     
-    readerOptions.traversalLimitInWords = 1000000000000;
-    readerOptions.nestingLimit = 1000000;
+    capnp::MinHash::ReferenceList::Reader referenceListReader = getReferenceListReader(reader);
     
-    capnp::FlatArrayMessageReader * message = new capnp::FlatArrayMessageReader(kj::ArrayPtr<const capnp::word>(reinterpret_cast<const capnp::word *>(data), fileInfo.st_size / sizeof(capnp::word)), readerOptions);
-    capnp::MinHash::Reader reader = message->getRoot<capnp::MinHash>();
+    capnp::List<capnp::MinHash::ReferenceList::Reference>::Reader referencesReader = referenceListReader.getReferences();
     
-    capnp::MinHash::ReferenceList::Reader referenceListReader = reader.getReferenceList().getReferences().size() ? reader.getReferenceList() : reader.getReferenceListOld();
+    uint64_t start = input->referenceStart;
+    uint64_t end = input->referenceEnd < referencesReader.size() ? input->referenceEnd : referencesReader.size();
     
-    capnp::List<capnp::MinHash::ReferenceList::Reference>::Reader referencesReader = referenceListReader.getReferences();
+    if ( start > end )
+    {
+    	start = end;
+    }
     
-    references.resize(referencesReader.size());
+    references.resize(end - start);
     
-    for ( uint64_t i = 0; i < referencesReader.size(); i++ )
+    for ( uint64_t i = start; i < end; i++ )
     {
-        capnp::MinHash::ReferenceList::Reference::Reader referenceReader = referencesReader[i];
-        
-        Sketch::Reference & reference = references[i];
-        
-        reference.name = referenceReader.getName();
-        reference.comment = referenceReader.getComment();
-        
-        if ( referenceReader.getLength64() )
-        {
-        	reference.length = referenceReader.getLength64();
-        }
-        else
-        {
-	        reference.length = referenceReader.getLength();
-	    }
-        
-        reference.hashesSorted.setUse64(input->parameters.use64);
-        uint64_t hashCount;
-        
-        if ( input->parameters.use64 )
-        {
-            capnp::List<uint64_t>::Reader hashesReader = referenceReader.getHashes64();
-        
-        	hashCount = hashesReader.size();
-        	
-        	if ( hashCount > input->parameters.minHashesPerWindow )
-        	{
-        		hashCount = input->parameters.minHashesPerWindow;
-        	}
-        	
-            reference.hashesSorted.resize(hashCount);
-        
-            for ( uint64_t j = 0; j < hashCount; j++ )
-            {
-                reference.hashesSorted.set64(j, hashesReader[j]);
-            }
-        }
-        else
-        {
-            capnp::List<uint32_t>::Reader hashesReader = referenceReader.getHashes32();
-        	
-        	hashCount = hashesReader.size();
-        	
-        	if ( hashCount > input->parameters.minHashesPerWindow )
-        	{
-        		hashCount = input->parameters.minHashesPerWindow;
-        	}
-        	
-            reference.hashesSorted.resize(hashCount);
-        
-            for ( uint64_t j = 0; j < hashCount; j++ )
-            {
-                reference.hashesSorted.set32(j, hashesReader[j]);
-            }
-        }
-        
-        if ( referenceReader.hasCounts32() )
-        {
-			capnp::List<uint32_t>::Reader countsReader = referenceReader.getCounts32();
-		
-			reference.counts.resize(hashCount);
-		
-			for ( uint64_t j = 0; j < hashCount; j++ )
-			{
-				reference.counts[j] = countsReader[j];
-			}
-        }
+        loadReferenceFromCapnp(referencesReader[i], references[i - start], parameters);
     }
     
     capnp::MinHash::LocusList::Reader locusListReader = reader.getLocusList();
@@ -1011,8 +1676,14 @@ Sketch::SketchOutput * loadCapnp(Sketch::SketchInput * input)
     for ( uint64_t i = 0; i < lociReader.size(); i++ )
     {
         capnp::MinHash::LocusList::Locus::Reader locusReader = lociReader[i];
+        
+        if ( locusReader.getSequence() < start || locusReader.getSequence() >= end )
+        {
+        	continue;
+        }
+        
         //cout << locusReader.getHash64() << '\t' << locusReader.getSequence() << '\t' << locusReader.getPosition() << endl;
-        output->positionHashesByReference[locusReader.getSequence()].push_back(Sketch::PositionHash(locusReader.getPosition(), locusReader.getHash64()));
+        output->positionHashesByReference[locusReader.getSequence() - start].push_back(Sketch::PositionHash(locusReader.getPosition(), locusReader.getHash64()));
     }
     
     /*
@@ -1054,50 +1725,182 @@ Sketch::SketchOutput * loadCapnp(Sketch::SketchInput * input)
     cout << endl;
     */
     
-    munmap(data, fileInfo.st_size);
-    close(fd);
-    delete message;
+    if ( parameters.mapped )
+    {
+    	output->mappedFile = mappedFile;
+    }
     
     return output;
 }
 
 
-/* Array from 0..25 of DNA complement of A..Z */
-const char complement[] = {
-  'T', // 'A' = A
-  'V', // 'B' = not A = C,T,G
-  'G', // 'C' = C
-  'H', // 'D' = not C = A,T,G
-  'N', // 'E' = .
-  'N', // 'F' = .
-  'C', // 'G' = G
-  'D', // 'H' = not G = A,C,T
-  'N', // 'I' = .
-  'N', // 'J' = .
-  'M', // 'K' = T,G = Keto
-  'N', // 'L' = .
-  'K', // 'M' = A,C = Amino
-  'N', // 'N' = A,C,T,G = uNkNowN
-  'N', // 'O' = .
-  'N', // 'P' = .
-  'N', // 'Q' = .
-  'Y', // 'R' = A,G = puRine
-  'S', // 'S' = G,C = Strong
-  'A', // 'T' = T
-  'A', // 'U' = T (RNA)
-  'B', // 'V' = not T = A,C,G
-  'W', // 'W' = A,T = Weak
-  'N', // 'X' = .
-  'R', // 'Y' = pYrimidine = C,T
-  'N', // 'Z' = .
-};
+void loadReferenceFromCapnp(capnp::MinHash::ReferenceList::Reference::Reader referenceReader, Sketch::Reference & reference, const Sketch::Parameters & parameters)
+{
+    bool mapped = parameters.mapped && canViewMappedHashes;
+    
+    reference.name = referenceReader.getName();
+    reference.comment = referenceReader.getComment();
+    
+    if ( referenceReader.getLength64() )
+    {
+        reference.length = referenceReader.getLength64();
+    }
+    else
+    {
+        reference.length = referenceReader.getLength();
+    }
+    
+    reference.hashesSorted.setUse64(parameters.use64);
+    uint64_t hashCount;
+    
+    if ( referenceReader.hasHashesPacked() )
+    {
+        capnp::Data::Reader packedReader = referenceReader.getHashesPacked();
+        
+        if ( ! unpackHashes(packedReader.begin(), packedReader.size(), parameters.use64, parameters.minHashesPerWindow, reference.hashesSorted) )
+        {
+            cerr << "ERROR: The packed hashes of " << reference.name << " are corrupt." << endl;
+            exit(1);
+        }
+        
+        hashCount = reference.hashesSorted.size();
+    }
+    else if ( parameters.use64 )
+    {
+        capnp::List<uint64_t>::Reader hashesReader = referenceReader.getHashes64();
+        
+        hashCount = hashesReader.size();
+        
+        if ( hashCount > parameters.minHashesPerWindow )
+        {
+            hashCount = parameters.minHashesPerWindow;
+        }
+        
+        if ( mapped )
+        {
+            reference.hashesSorted.setView(capnp::AnyList::Reader(hashesReader).getRawBytes().begin(), hashCount);
+        }
+        else
+        {
+            reference.hashesSorted.resize(hashCount);
+            
+            for ( uint64_t j = 0; j < hashCount; j++ )
+            {
+                reference.hashesSorted.set64(j, hashesReader[j]);
+            }
+        }
+    }
+    else
+    {
+        capnp::List<uint32_t>::Reader hashesReader = referenceReader.getHashes32();
+        
+        hashCount = hashesReader.size();
+        
+        if ( hashCount > parameters.minHashesPerWindow )
+        {
+            hashCount = parameters.minHashesPerWindow;
+        }
+        
+        if ( mapped )
+        {
+            reference.hashesSorted.setView(capnp::AnyList::Reader(hashesReader).getRawBytes().begin(), hashCount);
+        }
+        else
+        {
+            reference.hashesSorted.resize(hashCount);
+            
+            for ( uint64_t j = 0; j < hashCount; j++ )
+            {
+                reference.hashesSorted.set32(j, hashesReader[j]);
+            }
+        }
+    }
+    
+    if ( referenceReader.hasCounts32() )
+    {
+        capnp::List<uint32_t>::Reader countsReader = referenceReader.getCounts32();
+        
+        reference.counts.resize(hashCount);
+        
+        for ( uint64_t j = 0; j < hashCount; j++ )
+        {
+            reference.counts[j] = countsReader[j];
+        }
+    }
+}
 
-void reverseComplement(const char * src, char * dest, int length)
+Sketch::MappedFile * mapCapnp(const char * file)
 {
-    for ( int i = 0; i < length; i++ )
+    int fd = open(file, O_RDONLY);
+    
+    if ( fd < 0 )
+    {
+        return 0;
+    }
+    
+    struct stat fileInfo;
+    
+    if ( fstat(fd, &fileInfo) == -1 )
+    {
+        close(fd);
+        return 0;
+    }
+    
+    void * data = mmap(NULL, fileInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    
+    // the mapping outlives the descriptor, so many files can stay mapped
+    //
+    close(fd);
+    
+    if ( data == MAP_FAILED )
+    {
+        return 0;
+    }
+    
+    capnp::ReaderOptions readerOptions;
+    
+    readerOptions.traversalLimitInWords = 1000000000000;
+    readerOptions.nestingLimit = 1000000;
+    
+    Sketch::MappedFile * mappedFile = new Sketch::MappedFile(data, fileInfo.st_size);
+    
+    const capnp::word * words = reinterpret_cast<const capnp::word *>(data);
+    const capnp::word * end = words + fileInfo.st_size / sizeof(capnp::word);
+    
+    if ( hasFileMarker(data, fileInfo.st_size) )
     {
-        dest[i] = complement[ (int) src[length-i-1] - (int) 'A' ];
+    	words++;
     }
+    
+    mappedFile->messages.push_back(new capnp::FlatArrayMessageReader(kj::ArrayPtr<const capnp::word>(words, end - words), readerOptions));
+    
+    if ( mappedFile->getHeader().getSegmented() )
+    {
+    	mappedFile->firstSegment = 1;
+    	
+    	for ( const capnp::word * next = mappedFile->messages.back()->getEnd(); next < end; next = mappedFile->messages.back()->getEnd() )
+    	{
+    		// a segment cut short (by an append that was killed) loses only
+    		// itself
+    		//
+    		try
+    		{
+			    mappedFile->messages.push_back(new capnp::FlatArrayMessageReader(kj::ArrayPtr<const capnp::word>(next, end - next), readerOptions));
+			}
+			catch ( const kj::Exception & )
+			{
+				cerr << "WARNING: ignoring an incomplete segment at the end of \"" << file << "\"." << endl;
+				break;
+			}
+		}
+    }
+    
+    return mappedFile;
+}
+
+void reverseComplement(const char * src, char * dest, int length)
+{
+    getCpuKernels().reverseComplement(src, dest, length);
 }
 
 void setAlphabetFromString(Sketch::Parameters & parameters, const char * characters)
@@ -1232,7 +2035,7 @@ Sketch::SketchOutput * sketchFile(Sketch::SketchInput * input)
 		kseqs.push_back(kseq_init(fps[f]));
 	}
 
-	MinHashHeap KmerStatsTable(parameters.use64, parameters.minHashesPerWindow, parameters.reads ? parameters.minCov : 1, parameters.memoryBound);
+	MinHashHeap KmerStatsTable(parameters.use64, parameters.minHashesPerWindow, parameters.reads ? parameters.minCov : 1, parameters.memoryBound, true);
 
 	kmerStatistics(KmerStatsTable, kseqs, input, parameters);	
 
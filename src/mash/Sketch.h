@@ -8,8 +8,10 @@
 #define Sketch_h
 
 #include "mash/capnp/MinHash.capnp.h"
+#include <capnp/serialize.h>
 #include "robin_hood.h"
 #include <map>
+#include <memory>
 #include <vector>
 #include <string>
 #include <string.h>
@@ -35,6 +37,8 @@ public:
     
     typedef uint64_t hash_t;
     
+    Sketch() : segmentFd(-1), segmentStart(0), segmentBytes(0) {}
+    
     struct Parameters
     {
         Parameters()
@@ -45,6 +49,7 @@ public:
             preserveCase(false),
             use64(false),
             seed(0),
+            hashFunction(hashFunctionMurmur3),
             error(0),
             warning(0),
             minHashesPerWindow(0),
@@ -56,7 +61,10 @@ public:
             memoryBound(0),
             minCov(1),
             targetCov(0),
-            genomeSize(0)
+            genomeSize(0),
+            hashEncoding(0),
+            segmentSize(0),
+            mapped(false)
         {
         	memset(alphabet, 0, 256);
         }
@@ -69,6 +77,7 @@ public:
             preserveCase(other.preserveCase),
             use64(other.use64),
             seed(other.seed),
+            hashFunction(other.hashFunction),
             error(other.error),
             warning(other.warning),
             minHashesPerWindow(other.minHashesPerWindow),
@@ -80,7 +89,10 @@ public:
             memoryBound(other.memoryBound),
             minCov(other.minCov),
             targetCov(other.targetCov),
-            genomeSize(other.genomeSize)
+            genomeSize(other.genomeSize),
+            hashEncoding(other.hashEncoding),
+            segmentSize(other.segmentSize),
+            mapped(other.mapped)
 		{
 			memcpy(alphabet, other.alphabet, 256);
 		}
@@ -92,6 +104,7 @@ public:
         bool preserveCase;
         bool use64;
         uint32_t seed;
+        HashFunction hashFunction;
         double error;
         double warning;
         uint64_t minHashesPerWindow;
@@ -104,6 +117,46 @@ public:
         uint32_t minCov;
         double targetCov;
         uint64_t genomeSize;
+        
+        // 0 to write hash lists, or hashEncodingVersion to write packed hashes
+        //
+        uint32_t hashEncoding;
+        
+        // with setSegmentFile(), write references in segments of about this
+        // many bytes as they are added
+        //
+        uint64_t segmentSize;
+        
+        // keep large loaded sketch files mapped, with references viewing
+        // their hashes rather than copying them
+        //
+        bool mapped;
+    };
+    
+    // A sketch file kept mapped (with its message readers) for as long as
+    // references may view its hashes. Segmented files are a header message
+    // followed by a message for each segment of references; other files are
+    // one message, which is both.
+    //
+    struct MappedFile
+    {
+    	MappedFile(void * dataNew, uint64_t sizeNew)
+    	:
+    	data(dataNew),
+    	size(sizeNew),
+    	firstSegment(0)
+    	{}
+    	
+    	~MappedFile();
+    	
+    	capnp::MinHash::Reader getHeader() const {return messages[0]->getRoot<capnp::MinHash>();}
+    	capnp::MinHash::Reader getSegment(uint64_t index) const {return messages[firstSegment + index]->getRoot<capnp::MinHash>();}
+    	uint64_t getSegmentCount() const {return messages.size() - firstSegment;}
+    	
+    	void * data;
+    	uint64_t size;
+    	std::vector<capnp::FlatArrayMessageReader *> messages;
+    	uint64_t firstSegment;
     };
     
     struct PositionHash
@@ -149,7 +202,10 @@ public:
     	length(lengthNew),
     	name(nameNew),
     	comment(commentNew),
-    	parameters(parametersNew)
+    	parameters(parametersNew),
+    	segment(0),
+    	referenceStart(0),
+    	referenceEnd(-1)
     	{}
     	
     	~SketchInput()
@@ -170,20 +226,33 @@ public:
     	std::string comment;
     	
     	Sketch::Parameters parameters;
+    	
+    	// the range of references to load from a segment of a sketch file, so
+    	// large files can be split across threads that share one mapping
+    	//
+    	uint64_t segment;
+    	uint64_t referenceStart;
+    	uint64_t referenceEnd;
+    	std::shared_ptr<MappedFile> mappedFile;
     };
     
     struct SketchOutput
     {
     	std::vector<Reference> references;
 	    std::vector<std::vector<PositionHash>> positionHashesByReference;
+	    std::shared_ptr<MappedFile> mappedFile;
     };
     
+    int appendToCapnp(const char * file) const;
+    void finishSegments();
     void getAlphabetAsString(std::string & alphabet) const;
     uint32_t getAlphabetSize() const {return parameters.alphabetSize;}
     bool getConcatenated() const {return parameters.concatenated;}
     float getError() const {return parameters.error;}
     int getHashCount() const {return lociByHash.size();}
+    HashFunction getHashFunction() const {return parameters.hashFunction;}
     uint32_t getHashSeed() const {return parameters.seed;}
+    const Parameters & getParameters() const {return parameters;}
     const std::vector<Locus> & getLociByHash(hash_t hash) const;
     float getMinHashesPerWindow() const {return parameters.minHashesPerWindow;}
 	int getMinKmerSize(uint64_t reference) const;
@@ -200,11 +269,14 @@ public:
     bool getNoncanonical() const {return parameters.noncanonical;}
     bool hasHashCounts() const {return references.size() > 0 && references.at(0).counts.size() > 0;}
     bool hasLociByHash(hash_t hash) const {return lociByHash.count(hash);}
+    int initFromCapnpById(const char * file, const std::vector<std::string> & ids, const Parameters & parametersNew);
     int initFromFiles(const std::vector<std::string> & files, const Parameters & parametersNew, int verbosity = 0, bool enforceParameters = false, bool contain = false);
     void initFromReads(const std::vector<std::string> & files, const Parameters & parametersNew);
     uint64_t initParametersFromCapnp(const char * file);
+    uint64_t initParametersFromCapnp(const MappedFile & mappedFile, const char * file);
     void setReferenceName(int i, const std::string name) {references[i].name = name;}
     void setReferenceComment(int i, const std::string comment) {references[i].comment = comment;}
+    void setSegmentFile(const std::string & file) {segmentFile = file;}
 	bool sketchFileBySequence(FILE * file, ThreadPool<Sketch::SketchInput, Sketch::SketchOutput> * threadPool);
 	void useThreadOutput(SketchOutput * output);
     void warnKmerSize(uint64_t lengthMax, const std::string & lengthMaxName, double randomChance, int kMin, int warningCount) const;
@@ -214,8 +286,11 @@ public:
 private:
     
     void createIndex();
+    void writeSegment();
+    void writeToCapnpBuilder(capnp::MinHash::Builder builder, uint64_t start, uint64_t end) const;
     
     std::vector<Reference> references;
+    std::vector<std::shared_ptr<MappedFile>> mappedFiles;
     robin_hood::unordered_map<std::string, int> referenceIndecesById;
     std::vector<std::vector<PositionHash>> positionHashesByReference;
     robin_hood::unordered_map<hash_t, std::vector<Locus>> lociByHash;
@@ -223,14 +298,31 @@ private:
     Parameters parameters;
     double kmerSpace;
     std::string file;
+    
+    // references before segmentStart have been written (to segmentFd) and
+    // keep only their names, comments and lengths
+    //
+    std::string segmentFile;
+    int segmentFd;
+    uint64_t segmentStart;
+    uint64_t segmentBytes;
 };
 
 //void kmerStatistics(MinHashHeap & KmerStatsTable, list<int *> kseqs, Sketch::SketchInput * input, const Sketch::Parameters& parameters);
 
 void addMinHashes(MinHashHeap & minHashHeap, char * seq, uint64_t length, const Sketch::Parameters & parameters);
+template <int kmerSizeFixed> void addMinHashesNucleotide(MinHashHeap & minHashHeap, const char * seq, uint64_t length, const Sketch::Parameters & parameters);
+void addMinHashesRolling(MinHashHeap & minHashHeap, const char * seq, uint64_t length, const Sketch::Parameters & parameters);
+template <int kmerSizeFixed> void addMinHashesString(MinHashHeap & minHashHeap, char * seq, uint64_t length, const Sketch::Parameters & parameters);
+uint64_t findReferenceInCapnp(capnp::MinHash::ReferenceList::Reader referenceListReader, const std::string & id);
+capnp::MinHash::ReferenceList::Reader getReferenceListReader(capnp::MinHash::Reader reader);
 void getMinHashPositions(std::vector<Sketch::PositionHash> & loci, char * seq, uint32_t length, const Sketch::Parameters & parameters, int verbosity = 0);
+bool hasNucleotideEncoding(const Sketch::Parameters & parameters);
 bool hasSuffix(std::string const & whole, std::string const & suffix);
+void insertHashes(MinHashHeap & minHashHeap, const char * const * kmers, int count, const Sketch::Parameters & parameters);
 Sketch::SketchOutput * loadCapnp(Sketch::SketchInput * input);
+void loadReferenceFromCapnp(capnp::MinHash::ReferenceList::Reference::Reader referenceReader, Sketch::Reference & reference, const Sketch::Parameters & parameters);
+Sketch::MappedFile * mapCapnp(const char * file);
 void reverseComplement(const char * src, char * dest, int length);
 void setAlphabetFromString(Sketch::Parameters & parameters, const char * characters);
 void setMinHashesForReference(Sketch::Reference & reference, const MinHashHeap & hashes);
@@ -0,0 +1,281 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#include "SketchIndex.h"
+#include <algorithm>
+#include <queue>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+static const char indexMagic[8] = "mashidx";
+static const uint32_t indexVersion = 1;
+
+// the next hash of one reference, for merging the references' sorted lists
+//
+struct HashCursor
+{
+	uint64_t hash;
+	uint32_t reference;
+	uint32_t position;
+};
+
+// ordered so a priority_queue pops the smallest hash, then reference, first
+//
+struct HashCursorGreater
+{
+	bool operator()(const HashCursor & a, const HashCursor & b) const
+	{
+		return a.hash > b.hash || (a.hash == b.hash && a.reference > b.reference);
+	}
+};
+
+static uint64_t getHash(const HashList & hashList, uint64_t index)
+{
+	return hashList.get64() ? hashList.data64()[index] : hashList.data32()[index];
+}
+
+static bool writeAll(int fd, const void * data, uint64_t size)
+{
+	const char * bytes = (const char *)data;
+	
+	while ( size > 0 )
+	{
+		ssize_t written = write(fd, bytes, size);
+		
+		if ( written <= 0 )
+		{
+			return false;
+		}
+		
+		bytes += written;
+		size -= written;
+	}
+	
+	return true;
+}
+
+SketchIndex::SketchIndex()
+{
+	memset(&header, 0, sizeof(Header));
+	
+	hashes = 0;
+	offsets = 0;
+	postings = 0;
+	data = 0;
+	size = 0;
+}
+
+SketchIndex::~SketchIndex()
+{
+	if ( data )
+	{
+		munmap(data, size);
+	}
+}
+
+void SketchIndex::build(const Sketch & sketch, const string & fileSketch)
+{
+	// each reference's hashes are sorted, so merging them gives the postings
+	// in order without holding every (hash, reference) pair
+	
+	priority_queue<HashCursor, vector<HashCursor>, HashCursorGreater> cursors;
+	uint64_t postingCount = 0;
+	
+	for ( uint64_t i = 0; i < sketch.getReferenceCount(); i++ )
+	{
+		const HashList & hashList = sketch.getReference(i).hashesSorted;
+		
+		if ( hashList.size() > 0 )
+		{
+			HashCursor cursor;
+			
+			cursor.hash = getHash(hashList, 0);
+			cursor.reference = i;
+			cursor.position = 0;
+			cursors.push(cursor);
+			
+			postingCount += hashList.size();
+		}
+	}
+	
+	hashesBuilt.clear();
+	offsetsBuilt.clear();
+	postingsBuilt.clear();
+	postingsBuilt.reserve(postingCount);
+	
+	while ( ! cursors.empty() )
+	{
+		HashCursor cursor = cursors.top();
+		cursors.pop();
+		
+		if ( hashesBuilt.empty() || cursor.hash != hashesBuilt.back() )
+		{
+			hashesBuilt.push_back(cursor.hash);
+			offsetsBuilt.push_back(postingsBuilt.size());
+		}
+		
+		postingsBuilt.push_back(cursor.reference);
+		
+		const HashList & hashList = sketch.getReference(cursor.reference).hashesSorted;
+		
+		if ( ++cursor.position < hashList.size() )
+		{
+			cursor.hash = getHash(hashList, cursor.position);
+			cursors.push(cursor);
+		}
+	}
+	
+	offsetsBuilt.push_back(postingsBuilt.size());
+	
+	struct stat fileInfo;
+	
+	memset(&header, 0, sizeof(Header));
+	memcpy(header.magic, indexMagic, sizeof(indexMagic));
+	header.version = indexVersion;
+	
+	if ( stat(fileSketch.c_str(), &fileInfo) == 0 )
+	{
+		header.sketchFileSize = fileInfo.st_size;
+		header.sketchFileTime = fileInfo.st_mtime;
+	}
+	
+	header.referenceCount = sketch.getReferenceCount();
+	header.hashCount = hashesBuilt.size();
+	header.postingCount = postingsBuilt.size();
+	
+	hashes = hashesBuilt.data();
+	offsets = offsetsBuilt.data();
+	postings = postingsBuilt.data();
+}
+
+void SketchIndex::getCandidates(const HashList & hashList, uint64_t * candidates) const
+{
+	// the query hashes are sorted too, so each search starts where the last
+	// one ended
+	
+	const uint64_t * position = hashes;
+	const uint64_t * end = hashes + header.hashCount;
+	
+	for ( int i = 0; i < hashList.size() && position < end; i++ )
+	{
+		uint64_t hash = getHash(hashList, i);
+		
+		position = lower_bound(position, end, hash);
+		
+		if ( position == end || *position != hash )
+		{
+			continue;
+		}
+		
+		uint64_t index = position - hashes;
+		
+		for ( uint64_t j = offsets[index]; j < offsets[index + 1]; j++ )
+		{
+			candidates[postings[j] / 64] |= uint64_t(1) << (postings[j] % 64);
+		}
+	}
+}
+
+bool SketchIndex::read(const string & file, const string & fileSketch, uint64_t referenceCount)
+{
+	struct stat fileInfo;
+	
+	if ( stat(fileSketch.c_str(), &fileInfo) != 0 )
+	{
+		return false;
+	}
+	
+	int fd = open(file.c_str(), O_RDONLY);
+	
+	if ( fd < 0 )
+	{
+		return false;
+	}
+	
+	struct stat indexInfo;
+	
+	if ( fstat(fd, &indexInfo) == -1 || (uint64_t)indexInfo.st_size < sizeof(Header) )
+	{
+		close(fd);
+		return false;
+	}
+	
+	void * dataNew = mmap(NULL, indexInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	
+	close(fd);
+	
+	if ( dataNew == MAP_FAILED )
+	{
+		return false;
+	}
+	
+	const Header * headerNew = (const Header *)dataNew;
+	
+	bool valid =
+		memcmp(headerNew->magic, indexMagic, sizeof(indexMagic)) == 0 &&
+		headerNew->version == indexVersion &&
+		headerNew->sketchFileSize == fileInfo.st_size &&
+		headerNew->sketchFileTime == fileInfo.st_mtime &&
+		headerNew->referenceCount == referenceCount &&
+		(uint64_t)indexInfo.st_size == sizeof(Header) + (2 * headerNew->hashCount + 1) * sizeof(uint64_t) + headerNew->postingCount * sizeof(uint32_t);
+	
+	if ( ! valid )
+	{
+		munmap(dataNew, indexInfo.st_size);
+		return false;
+	}
+	
+	if ( data )
+	{
+		munmap(data, size);
+	}
+	
+	data = dataNew;
+	size = indexInfo.st_size;
+	header = *headerNew;
+	
+	hashes = (const uint64_t *)((const char *)data + sizeof(Header));
+	offsets = hashes + header.hashCount;
+	postings = (const uint32_t *)(offsets + header.hashCount + 1);
+	
+	return true;
+}
+
+bool SketchIndex::write(const string & file) const
+{
+	// write to a temporary file and rename, so readers never see part of an
+	// index
+	
+	string fileTemp = file + ".tmp";
+	int fd = open(fileTemp.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+	
+	if ( fd < 0 )
+	{
+		return false;
+	}
+	
+	bool success =
+		writeAll(fd, &header, sizeof(Header)) &&
+		writeAll(fd, hashes, header.hashCount * sizeof(uint64_t)) &&
+		writeAll(fd, offsets, (header.hashCount + 1) * sizeof(uint64_t)) &&
+		writeAll(fd, postings, header.postingCount * sizeof(uint32_t));
+	
+	close(fd);
+	
+	if ( ! success || rename(fileTemp.c_str(), file.c_str()) != 0 )
+	{
+		unlink(fileTemp.c_str());
+		return false;
+	}
+	
+	return true;
+}
@@ -0,0 +1,79 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#ifndef SketchIndex_h
+#define SketchIndex_h
+
+#include "Sketch.h"
+#include <string>
+#include <vector>
+
+static const char * suffixIndex = ".idx";
+
+// An inverted index of a sketch file: each distinct hash with the (sorted)
+// indices of the references that have it. It is saved next to the sketch
+// ("<sketch>.idx") and mapped when read:
+//
+//   Header
+//   uint64_t  hashes[hashCount], sorted (32-bit hashes are widened)
+//   uint64_t  offsets[hashCount + 1], into postings
+//   uint32_t  postings[postingCount]
+//
+// The header records the size and modification time of the sketch file, so
+// an index left over from an older sketch is not used.
+//
+class SketchIndex
+{
+public:
+
+    SketchIndex();
+    ~SketchIndex();
+    
+    void build(const Sketch & sketch, const std::string & fileSketch);
+    
+    // Sets bit i of candidates, which must hold (getReferenceCount() + 63) / 64
+    // words, for each reference i that has at least one of the hashes.
+    //
+    void getCandidates(const HashList & hashes, uint64_t * candidates) const;
+    
+    uint64_t getReferenceCount() const {return header.referenceCount;}
+    
+    // Returns false if the index is missing, malformed or out of date.
+    //
+    bool read(const std::string & file, const std::string & fileSketch, uint64_t referenceCount);
+    
+    bool write(const std::string & file) const;
+
+private:
+
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+        uint64_t sketchFileSize;
+        int64_t sketchFileTime;
+        uint64_t referenceCount;
+        uint64_t hashCount;
+        uint64_t postingCount;
+    };
+    
+    Header header;
+    
+    const uint64_t * hashes;
+    const uint64_t * offsets;
+    const uint32_t * postings;
+    
+    // built indexes own their arrays; read ones view the mapped file
+    //
+    std::vector<uint64_t> hashesBuilt;
+    std::vector<uint64_t> offsetsBuilt;
+    std::vector<uint32_t> postingsBuilt;
+    void * data;
+    uint64_t size;
+};
+
+#endif
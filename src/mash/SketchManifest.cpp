@@ -0,0 +1,237 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#include "SketchManifest.h"
+#include <fstream>
+#include <iostream>
+#include <limits.h>
+#include <sstream>
+#include <stdlib.h>
+
+using namespace std;
+
+static const char * manifestHeader = "#mash manifest";
+static const int manifestVersion = 1;
+
+void SketchManifest::addShard(const string & file, const Sketch & sketch)
+{
+	Shard shard;
+	
+	shard.file = file;
+	shard.referenceCount = sketch.getReferenceCount();
+	shard.hashMin = -1;
+	shard.hashMax = 0;
+	
+	for ( uint64_t i = 0; i < sketch.getReferenceCount(); i++ )
+	{
+		const HashList & hashes = sketch.getReference(i).hashesSorted;
+		
+		if ( hashes.size() == 0 )
+		{
+			continue;
+		}
+		
+		uint64_t first = hashes.get64() ? hashes.data<hash64_t>()[0] : hashes.data<hash32_t>()[0];
+		uint64_t last = hashes.get64() ? hashes.data<hash64_t>()[hashes.size() - 1] : hashes.data<hash32_t>()[hashes.size() - 1];
+		
+		if ( first < shard.hashMin )
+		{
+			shard.hashMin = first;
+		}
+		
+		if ( last > shard.hashMax )
+		{
+			shard.hashMax = last;
+		}
+	}
+	
+	if ( shard.hashMin > shard.hashMax )
+	{
+		shard.hashMin = 0;
+	}
+	
+	shards.push_back(shard);
+}
+
+void SketchManifest::checkShard(uint64_t index, const Sketch & sketch, uint64_t referenceCount) const
+{
+	const Shard & shard = shards[index];
+	SketchManifest manifestShard;
+	
+	manifestShard.setParameters(sketch);
+	
+	for ( int i = 0; i < parameters.size(); i++ )
+	{
+		for ( int j = 0; j < manifestShard.parameters.size(); j++ )
+		{
+			if ( parameters[i].first == manifestShard.parameters[j].first && parameters[i].second != manifestShard.parameters[j].second )
+			{
+				cerr << "\nWARNING: The shard " << shard.file << " has " << parameters[i].first << " " << manifestShard.parameters[j].second << ", but the manifest " << file << " has " << parameters[i].second << ". The manifest may be out of date." << endl << endl;
+			}
+		}
+	}
+	
+	if ( referenceCount != shard.referenceCount )
+	{
+		cerr << "\nWARNING: The shard " << shard.file << " has " << referenceCount << " sketches, but the manifest " << file << " lists " << shard.referenceCount << ". The manifest may be out of date." << endl << endl;
+	}
+}
+
+void SketchManifest::read(const string & fileWithShards)
+{
+	// split off the shard selector, if any
+	
+	string selector;
+	
+	file = fileWithShards;
+	size_t suffixPosition = fileWithShards.rfind(suffixManifest);
+	
+	if ( suffixPosition != string::npos && fileWithShards.size() > suffixPosition + strlen(suffixManifest) && fileWithShards[suffixPosition + strlen(suffixManifest)] == ':' )
+	{
+		file = fileWithShards.substr(0, suffixPosition + strlen(suffixManifest));
+		selector = fileWithShards.substr(suffixPosition + strlen(suffixManifest) + 1);
+	}
+	
+	ifstream in(file);
+	
+	if ( in.fail() )
+	{
+		cerr << "ERROR: Could not open " << file << ".\n";
+		exit(1);
+	}
+	
+	string directory = file.rfind('/') == string::npos ? "" : file.substr(0, file.rfind('/') + 1);
+	string line;
+	
+	if ( ! getline(in, line) || line.compare(0, strlen(manifestHeader), manifestHeader) != 0 )
+	{
+		cerr << "ERROR: " << file << " is not a sketch manifest.\n";
+		exit(1);
+	}
+	
+	if ( atoi(line.c_str() + strlen(manifestHeader)) > manifestVersion )
+	{
+		cerr << "ERROR: " << file << " is a newer version of sketch manifest than this version of Mash can read.\n";
+		exit(1);
+	}
+	
+	vector<Shard> shardsAll;
+	
+	while ( getline(in, line) )
+	{
+		if ( line.size() == 0 )
+		{
+			continue;
+		}
+		
+		istringstream fields(line);
+		
+		if ( line[0] == '#' )
+		{
+			string key;
+			string value;
+			
+			getline(fields, key, '\t');
+			getline(fields, value);
+			parameters.push_back(pair<string, string>(key.substr(1), value));
+			continue;
+		}
+		
+		Shard shard;
+		
+		if ( ! getline(fields, shard.file, '\t') || ! (fields >> shard.referenceCount >> shard.hashMin >> shard.hashMax) )
+		{
+			cerr << "ERROR: Malformed line in sketch manifest " << file << ":\n" << line << endl;
+			exit(1);
+		}
+		
+		if ( shard.file[0] != '/' )
+		{
+			shard.file = directory + shard.file;
+		}
+		
+		shardsAll.push_back(shard);
+	}
+	
+	if ( selector.size() == 0 )
+	{
+		shards.insert(shards.end(), shardsAll.begin(), shardsAll.end());
+		return;
+	}
+	
+	// comma-separated indices or ranges (first-last)
+	
+	istringstream ranges(selector);
+	string range;
+	
+	while ( getline(ranges, range, ',') )
+	{
+		char * end;
+		uint64_t first = strtoull(range.c_str(), &end, 10);
+		uint64_t last = *end == '-' ? strtoull(end + 1, &end, 10) : first;
+		
+		if ( range.size() == 0 || *end != 0 || first > last || last >= shardsAll.size() )
+		{
+			cerr << "ERROR: Invalid shards \"" << range << "\" for " << file << ", which has " << shardsAll.size() << " shards (numbered from 0).\n";
+			exit(1);
+		}
+		
+		shards.insert(shards.end(), shardsAll.begin() + first, shardsAll.begin() + last + 1);
+	}
+}
+
+void SketchManifest::setParameters(const Sketch & sketch)
+{
+	string alphabet;
+	sketch.getAlphabetAsString(alphabet);
+	
+	parameters.clear();
+	parameters.push_back(pair<string, string>("kmer", to_string(sketch.getKmerSize())));
+	parameters.push_back(pair<string, string>("alphabet", alphabet));
+	parameters.push_back(pair<string, string>("canonical", sketch.getNoncanonical() ? "false" : "true"));
+	parameters.push_back(pair<string, string>("preserveCase", sketch.getPreserveCase() ? "true" : "false"));
+	parameters.push_back(pair<string, string>("sketchSize", to_string((uint64_t)sketch.getMinHashesPerWindow())));
+	parameters.push_back(pair<string, string>("hashType", getHashFunctionName(sketch.getHashFunction())));
+	parameters.push_back(pair<string, string>("hashBits", sketch.getUse64() ? "64" : "32"));
+	parameters.push_back(pair<string, string>("hashSeed", to_string(sketch.getHashSeed())));
+}
+
+void SketchManifest::write(const string & file) const
+{
+	ofstream out(file);
+	
+	if ( out.fail() )
+	{
+		cerr << "ERROR: could not open " << file << " for writing.\n";
+		exit(1);
+	}
+	
+	out << manifestHeader << ' ' << manifestVersion << endl;
+	
+	for ( int i = 0; i < parameters.size(); i++ )
+	{
+		out << '#' << parameters[i].first << '\t' << parameters[i].second << endl;
+	}
+	
+	for ( int i = 0; i < shards.size(); i++ )
+	{
+		out << shards[i].file << '\t' << shards[i].referenceCount << '\t' << shards[i].hashMin << '\t' << shards[i].hashMax << endl;
+	}
+}
+
+bool isManifest(const string & file)
+{
+	size_t suffixPosition = file.rfind(suffixManifest);
+	
+	if ( suffixPosition == string::npos )
+	{
+		return false;
+	}
+	
+	size_t end = suffixPosition + strlen(suffixManifest);
+	
+	return end == file.size() || file[end] == ':';
+}
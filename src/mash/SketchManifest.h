@@ -0,0 +1,53 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#ifndef SketchManifest_h
+#define SketchManifest_h
+
+#include "Sketch.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+static const char * suffixManifest = ".mshm";
+
+// A sharded sketch database: a text file listing sketch files (shards) that
+// share parameters, with the reference count and hash range of each. Relative
+// shard paths are relative to the manifest. Anywhere a manifest is read, a
+// subset of shards can be chosen by index, e.g. "db.mshm:0-3,7". Shards are
+// checked against the parameters and reference counts as they are loaded.
+//
+class SketchManifest
+{
+public:
+
+    struct Shard
+    {
+        std::string file;
+        uint64_t referenceCount;
+        uint64_t hashMin;
+        uint64_t hashMax;
+    };
+    
+    void addShard(const std::string & file, const Sketch & sketch);
+    
+    // Warns if a shard, with parameters read into sketch, no longer matches
+    // the manifest (e.g. it was appended to after the manifest was written).
+    //
+    void checkShard(uint64_t index, const Sketch & sketch, uint64_t referenceCount) const;
+    
+    void read(const std::string & file);
+    void setParameters(const Sketch & sketch);
+    void write(const std::string & file) const;
+    
+    std::string file;
+    std::vector<Shard> shards;
+    std::vector<std::pair<std::string, std::string>> parameters;
+};
+
+bool isManifest(const std::string & file);
+
+#endif
@@ -1,691 +0,0 @@
-// Generated by Cap'n Proto compiler, DO NOT EDIT
-// source: MinHash.capnp
-
-#include "MinHash.capnp.h"
-
-namespace capnp {
-namespace schemas {
-static const ::capnp::_::AlignedData<218> b_d9d16806af782606 = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-      6,  38, 120, 175,   6, 104, 209, 217,
-     14,   0,   0,   0,   1,   0,   3,   0,
-      4, 119,  94, 160, 173, 177, 200, 196,
-      4,   0,   7,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 178,   0,   0,   0,
-     29,   0,   0,   0,  39,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     57,   0,   0,   0, 167,   2,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     77, 105, 110,  72,  97, 115, 104,  46,
-     99,  97, 112, 110, 112,  58,  77, 105,
-    110,  72,  97, 115, 104,   0,   0,   0,
-      8,   0,   0,   0,   1,   0,   1,   0,
-    208, 122, 219,   2, 157,  33, 113, 207,
-      9,   0,   0,   0, 114,   0,   0,   0,
-    221,  89, 179, 226, 134, 241, 221, 225,
-      9,   0,   0,   0,  82,   0,   0,   0,
-     82, 101, 102, 101, 114, 101, 110,  99,
-    101,  76, 105, 115, 116,   0,   0,   0,
-     76, 111,  99, 117, 115,  76, 105, 115,
-    116,   0,   0,   0,   0,   0,   0,   0,
-     48,   0,   0,   0,   3,   0,   4,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     65,   1,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     64,   1,   0,   0,   3,   0,   1,   0,
-     76,   1,   0,   0,   2,   0,   1,   0,
-      1,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   1,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     73,   1,   0,   0,  90,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     72,   1,   0,   0,   3,   0,   1,   0,
-     84,   1,   0,   0,   2,   0,   1,   0,
-      2,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   2,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     81,   1,   0,   0, 154,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     84,   1,   0,   0,   3,   0,   1,   0,
-     96,   1,   0,   0,   2,   0,   1,   0,
-      3,   0,   0,   0,  96,   0,   0,   0,
-      0,   0,   1,   0,   3,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     93,   1,   0,   0, 106,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     92,   1,   0,   0,   3,   0,   1,   0,
-    104,   1,   0,   0,   2,   0,   1,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   4,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    101,   1,   0,   0, 138,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    104,   1,   0,   0,   3,   0,   1,   0,
-    116,   1,   0,   0,   2,   0,   1,   0,
-     11,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   5,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    113,   1,   0,   0,  82,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    112,   1,   0,   0,   3,   0,   1,   0,
-    124,   1,   0,   0,   2,   0,   1,   0,
-      4,   0,   0,   0,   4,   0,   0,   0,
-      0,   0,   1,   0,   6,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    121,   1,   0,   0,  50,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    116,   1,   0,   0,   3,   0,   1,   0,
-    128,   1,   0,   0,   2,   0,   1,   0,
-      5,   0,   0,   0,  97,   0,   0,   0,
-      0,   0,   1,   0,   7,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    125,   1,   0,   0, 106,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    124,   1,   0,   0,   3,   0,   1,   0,
-    136,   1,   0,   0,   2,   0,   1,   0,
-      6,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   8,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    133,   1,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    132,   1,   0,   0,   3,   0,   1,   0,
-    144,   1,   0,   0,   2,   0,   1,   0,
-      7,   0,   0,   0,  98,   0,   0,   0,
-      0,   0,   1,   0,   9,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    141,   1,   0,   0, 106,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    140,   1,   0,   0,   3,   0,   1,   0,
-    152,   1,   0,   0,   2,   0,   1,   0,
-      8,   0,   0,   0,   5,   0,   0,   0,
-      0,   0,   1,   0,  10,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-    149,   1,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    148,   1,   0,   0,   3,   0,   1,   0,
-    160,   1,   0,   0,   2,   0,   1,   0,
-     10,   0,   0,   0,   3,   0,   0,   0,
-      0,   0,   1,   0,  11,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    157,   1,   0,   0, 114,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    156,   1,   0,   0,   3,   0,   1,   0,
-    168,   1,   0,   0,   2,   0,   1,   0,
-    107, 109, 101, 114,  83, 105, 122, 101,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    119, 105, 110, 100, 111, 119,  83, 105,
-    122, 101,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    109, 105, 110,  72,  97, 115, 104, 101,
-    115,  80, 101, 114,  87, 105, 110, 100,
-    111, 119,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     99, 111, 110,  99,  97, 116, 101, 110,
-     97, 116, 101, 100,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    114, 101, 102, 101, 114, 101, 110,  99,
-    101,  76, 105, 115, 116,  79, 108, 100,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    208, 122, 219,   2, 157,  33, 113, 207,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    108, 111,  99, 117, 115,  76, 105, 115,
-    116,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    221,  89, 179, 226, 134, 241, 221, 225,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    101, 114, 114, 111, 114,   0,   0,   0,
-     10,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     10,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    110, 111, 110,  99,  97, 110, 111, 110,
-    105,  99,  97, 108,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     97, 108, 112, 104,  97,  98, 101, 116,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    112, 114, 101, 115, 101, 114, 118, 101,
-     67,  97, 115, 101,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    104,  97, 115, 104,  83, 101, 101, 100,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,  42,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    114, 101, 102, 101, 114, 101, 110,  99,
-    101,  76, 105, 115, 116,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    208, 122, 219,   2, 157,  33, 113, 207,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
-};
-::capnp::word const* const bp_d9d16806af782606 = b_d9d16806af782606.words;
-#if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_d9d16806af782606[] = {
-  &s_cf71219d02db7ad0,
-  &s_e1ddf186e2b359dd,
-};
-static const uint16_t m_d9d16806af782606[] = {8, 3, 6, 10, 0, 5, 2, 7, 9, 11, 4, 1};
-static const uint16_t i_d9d16806af782606[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
-const ::capnp::_::RawSchema s_d9d16806af782606 = {
-  0xd9d16806af782606, b_d9d16806af782606.words, 218, d_d9d16806af782606, m_d9d16806af782606,
-  2, 12, i_d9d16806af782606, nullptr, nullptr, { &s_d9d16806af782606, nullptr, nullptr, 0, 0, nullptr }
-};
-#endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<43> b_cf71219d02db7ad0 = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-    208, 122, 219,   2, 157,  33, 113, 207,
-     22,   0,   0,   0,   1,   0,   0,   0,
-      6,  38, 120, 175,   6, 104, 209, 217,
-      1,   0,   7,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  34,   1,   0,   0,
-     37,   0,   0,   0,  23,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     49,   0,   0,   0,  63,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     77, 105, 110,  72,  97, 115, 104,  46,
-     99,  97, 112, 110, 112,  58,  77, 105,
-    110,  72,  97, 115, 104,  46,  82, 101,
-    102, 101, 114, 101, 110,  99, 101,  76,
-    105, 115, 116,   0,   0,   0,   0,   0,
-      4,   0,   0,   0,   1,   0,   1,   0,
-    191,  67, 225, 191,  76, 234, 195, 150,
-      1,   0,   0,   0,  82,   0,   0,   0,
-     82, 101, 102, 101, 114, 101, 110,  99,
-    101,   0,   0,   0,   0,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  90,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   3,   0,   1,   0,
-     40,   0,   0,   0,   2,   0,   1,   0,
-    114, 101, 102, 101, 114, 101, 110,  99,
-    101, 115,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    191,  67, 225, 191,  76, 234, 195, 150,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
-};
-::capnp::word const* const bp_cf71219d02db7ad0 = b_cf71219d02db7ad0.words;
-#if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_cf71219d02db7ad0[] = {
-  &s_96c3ea4cbfe143bf,
-};
-static const uint16_t m_cf71219d02db7ad0[] = {0};
-static const uint16_t i_cf71219d02db7ad0[] = {0};
-const ::capnp::_::RawSchema s_cf71219d02db7ad0 = {
-  0xcf71219d02db7ad0, b_cf71219d02db7ad0.words, 43, d_cf71219d02db7ad0, m_cf71219d02db7ad0,
-  1, 1, i_cf71219d02db7ad0, nullptr, nullptr, { &s_cf71219d02db7ad0, nullptr, nullptr, 0, 0, nullptr }
-};
-#endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<172> b_96c3ea4cbfe143bf = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-    191,  67, 225, 191,  76, 234, 195, 150,
-     36,   0,   0,   0,   1,   0,   2,   0,
-    208, 122, 219,   2, 157,  33, 113, 207,
-      7,   0,   7,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 114,   1,   0,   0,
-     41,   0,   0,   0,   7,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     37,   0,   0,   0, 255,   1,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     77, 105, 110,  72,  97, 115, 104,  46,
-     99,  97, 112, 110, 112,  58,  77, 105,
-    110,  72,  97, 115, 104,  46,  82, 101,
-    102, 101, 114, 101, 110,  99, 101,  76,
-    105, 115, 116,  46,  82, 101, 102, 101,
-    114, 101, 110,  99, 101,   0,   0,   0,
-      0,   0,   0,   0,   1,   0,   1,   0,
-     36,   0,   0,   0,   3,   0,   4,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    237,   0,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    236,   0,   0,   0,   3,   0,   1,   0,
-    248,   0,   0,   0,   2,   0,   1,   0,
-      1,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   1,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    245,   0,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    240,   0,   0,   0,   3,   0,   1,   0,
-    252,   0,   0,   0,   2,   0,   1,   0,
-      2,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   2,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    249,   0,   0,   0,  58,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    244,   0,   0,   0,   3,   0,   1,   0,
-      0,   1,   0,   0,   2,   0,   1,   0,
-      4,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   3,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    253,   0,   0,   0,  42,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    248,   0,   0,   0,   3,   0,   1,   0,
-      4,   1,   0,   0,   2,   0,   1,   0,
-      5,   0,   0,   0,   3,   0,   0,   0,
-      0,   0,   1,   0,   4,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      1,   1,   0,   0,  66,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    252,   0,   0,   0,   3,   0,   1,   0,
-      8,   1,   0,   0,   2,   0,   1,   0,
-      6,   0,   0,   0,   4,   0,   0,   0,
-      0,   0,   1,   0,   5,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      5,   1,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      4,   1,   0,   0,   3,   0,   1,   0,
-     32,   1,   0,   0,   2,   0,   1,   0,
-      7,   0,   0,   0,   5,   0,   0,   0,
-      0,   0,   1,   0,   6,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     29,   1,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     28,   1,   0,   0,   3,   0,   1,   0,
-     56,   1,   0,   0,   2,   0,   1,   0,
-      3,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   7,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     53,   1,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     52,   1,   0,   0,   3,   0,   1,   0,
-     64,   1,   0,   0,   2,   0,   1,   0,
-      8,   0,   0,   0,   6,   0,   0,   0,
-      0,   0,   1,   0,   8,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     61,   1,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     60,   1,   0,   0,   3,   0,   1,   0,
-     88,   1,   0,   0,   2,   0,   1,   0,
-    115, 101, 113, 117, 101, 110,  99, 101,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    113, 117,  97, 108, 105, 116, 121,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    108, 101, 110, 103, 116, 104,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    110,  97, 109, 101,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     99, 111, 109, 109, 101, 110, 116,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    104,  97, 115, 104, 101, 115,  51,  50,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    104,  97, 115, 104, 101, 115,  54,  52,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    108, 101, 110, 103, 116, 104,  54,  52,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     99, 111, 117, 110, 116, 115,  51,  50,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
-};
-::capnp::word const* const bp_96c3ea4cbfe143bf = b_96c3ea4cbfe143bf.words;
-#if !CAPNP_LITE
-static const uint16_t m_96c3ea4cbfe143bf[] = {4, 8, 5, 6, 2, 7, 3, 1, 0};
-static const uint16_t i_96c3ea4cbfe143bf[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
-const ::capnp::_::RawSchema s_96c3ea4cbfe143bf = {
-  0x96c3ea4cbfe143bf, b_96c3ea4cbfe143bf.words, 172, nullptr, m_96c3ea4cbfe143bf,
-  0, 9, i_96c3ea4cbfe143bf, nullptr, nullptr, { &s_96c3ea4cbfe143bf, nullptr, nullptr, 0, 0, nullptr }
-};
-#endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<40> b_e1ddf186e2b359dd = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-    221,  89, 179, 226, 134, 241, 221, 225,
-     22,   0,   0,   0,   1,   0,   0,   0,
-      6,  38, 120, 175,   6, 104, 209, 217,
-      1,   0,   7,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,   2,   1,   0,   0,
-     33,   0,   0,   0,  23,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     41,   0,   0,   0,  63,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     77, 105, 110,  72,  97, 115, 104,  46,
-     99,  97, 112, 110, 112,  58,  77, 105,
-    110,  72,  97, 115, 104,  46,  76, 111,
-     99, 117, 115,  76, 105, 115, 116,   0,
-      4,   0,   0,   0,   1,   0,   1,   0,
-    246,  89,  34, 143,  24, 215,  72, 166,
-      1,   0,   0,   0,  50,   0,   0,   0,
-     76, 111,  99, 117, 115,   0,   0,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  42,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   1,   0,
-     36,   0,   0,   0,   2,   0,   1,   0,
-    108, 111,  99, 105,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   3,   0,   1,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    246,  89,  34, 143,  24, 215,  72, 166,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     14,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
-};
-::capnp::word const* const bp_e1ddf186e2b359dd = b_e1ddf186e2b359dd.words;
-#if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_e1ddf186e2b359dd[] = {
-  &s_a648d7188f2259f6,
-};
-static const uint16_t m_e1ddf186e2b359dd[] = {0};
-static const uint16_t i_e1ddf186e2b359dd[] = {0};
-const ::capnp::_::RawSchema s_e1ddf186e2b359dd = {
-  0xe1ddf186e2b359dd, b_e1ddf186e2b359dd.words, 40, d_e1ddf186e2b359dd, m_e1ddf186e2b359dd,
-  1, 1, i_e1ddf186e2b359dd, nullptr, nullptr, { &s_e1ddf186e2b359dd, nullptr, nullptr, 0, 0, nullptr }
-};
-#endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<81> b_a648d7188f2259f6 = {
-  {   0,   0,   0,   0,   5,   0,   6,   0,
-    246,  89,  34, 143,  24, 215,  72, 166,
-     32,   0,   0,   0,   1,   0,   3,   0,
-    221,  89, 179, 226, 134, 241, 221, 225,
-      0,   0,   7,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  50,   1,   0,   0,
-     37,   0,   0,   0,   7,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     33,   0,   0,   0, 231,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     77, 105, 110,  72,  97, 115, 104,  46,
-     99,  97, 112, 110, 112,  58,  77, 105,
-    110,  72,  97, 115, 104,  46,  76, 111,
-     99, 117, 115,  76, 105, 115, 116,  46,
-     76, 111,  99, 117, 115,   0,   0,   0,
-      0,   0,   0,   0,   1,   0,   1,   0,
-     16,   0,   0,   0,   3,   0,   4,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     97,   0,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     96,   0,   0,   0,   3,   0,   1,   0,
-    108,   0,   0,   0,   2,   0,   1,   0,
-      1,   0,   0,   0,   1,   0,   0,   0,
-      0,   0,   1,   0,   1,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    105,   0,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    104,   0,   0,   0,   3,   0,   1,   0,
-    116,   0,   0,   0,   2,   0,   1,   0,
-      2,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   2,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    113,   0,   0,   0,  58,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    108,   0,   0,   0,   3,   0,   1,   0,
-    120,   0,   0,   0,   2,   0,   1,   0,
-      3,   0,   0,   0,   2,   0,   0,   0,
-      0,   0,   1,   0,   3,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    117,   0,   0,   0,  58,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    112,   0,   0,   0,   3,   0,   1,   0,
-    124,   0,   0,   0,   2,   0,   1,   0,
-    115, 101, 113, 117, 101, 110,  99, 101,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    112, 111, 115, 105, 116, 105, 111, 110,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    104,  97, 115, 104,  51,  50,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      8,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    104,  97, 115, 104,  54,  52,   0,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      9,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
-};
-::capnp::word const* const bp_a648d7188f2259f6 = b_a648d7188f2259f6.words;
-#if !CAPNP_LITE
-static const uint16_t m_a648d7188f2259f6[] = {2, 3, 1, 0};
-static const uint16_t i_a648d7188f2259f6[] = {0, 1, 2, 3};
-const ::capnp::_::RawSchema s_a648d7188f2259f6 = {
-  0xa648d7188f2259f6, b_a648d7188f2259f6.words, 81, nullptr, m_a648d7188f2259f6,
-  0, 4, i_a648d7188f2259f6, nullptr, nullptr, { &s_a648d7188f2259f6, nullptr, nullptr, 0, 0, nullptr }
-};
-#endif  // !CAPNP_LITE
-}  // namespace schemas
-}  // namespace capnp
-
-// =======================================================================================
-
-namespace capnp {
-
-// MinHash
-#ifndef _MSC_VER
-constexpr uint16_t MinHash::_capnpPrivate::dataWordSize;
-constexpr uint16_t MinHash::_capnpPrivate::pointerCount;
-#endif
-#if !CAPNP_LITE
-constexpr ::capnp::Kind MinHash::_capnpPrivate::kind;
-constexpr ::capnp::_::RawSchema const* MinHash::_capnpPrivate::schema;
-constexpr ::capnp::_::RawBrandedSchema const* MinHash::_capnpPrivate::brand;
-#endif  // !CAPNP_LITE
-
-// MinHash::ReferenceList
-#ifndef _MSC_VER
-constexpr uint16_t MinHash::ReferenceList::_capnpPrivate::dataWordSize;
-constexpr uint16_t MinHash::ReferenceList::_capnpPrivate::pointerCount;
-#endif
-#if !CAPNP_LITE
-constexpr ::capnp::Kind MinHash::ReferenceList::_capnpPrivate::kind;
-constexpr ::capnp::_::RawSchema const* MinHash::ReferenceList::_capnpPrivate::schema;
-constexpr ::capnp::_::RawBrandedSchema const* MinHash::ReferenceList::_capnpPrivate::brand;
-#endif  // !CAPNP_LITE
-
-// MinHash::ReferenceList::Reference
-#ifndef _MSC_VER
-constexpr uint16_t MinHash::ReferenceList::Reference::_capnpPrivate::dataWordSize;
-constexpr uint16_t MinHash::ReferenceList::Reference::_capnpPrivate::pointerCount;
-#endif
-#if !CAPNP_LITE
-constexpr ::capnp::Kind MinHash::ReferenceList::Reference::_capnpPrivate::kind;
-constexpr ::capnp::_::RawSchema const* MinHash::ReferenceList::Reference::_capnpPrivate::schema;
-constexpr ::capnp::_::RawBrandedSchema const* MinHash::ReferenceList::Reference::_capnpPrivate::brand;
-#endif  // !CAPNP_LITE
-
-// MinHash::LocusList
-#ifndef _MSC_VER
-constexpr uint16_t MinHash::LocusList::_capnpPrivate::dataWordSize;
-constexpr uint16_t MinHash::LocusList::_capnpPrivate::pointerCount;
-#endif
-#if !CAPNP_LITE
-constexpr ::capnp::Kind MinHash::LocusList::_capnpPrivate::kind;
-constexpr ::capnp::_::RawSchema const* MinHash::LocusList::_capnpPrivate::schema;
-constexpr ::capnp::_::RawBrandedSchema const* MinHash::LocusList::_capnpPrivate::brand;
-#endif  // !CAPNP_LITE
-
-// MinHash::LocusList::Locus
-#ifndef _MSC_VER
-constexpr uint16_t MinHash::LocusList::Locus::_capnpPrivate::dataWordSize;
-constexpr uint16_t MinHash::LocusList::Locus::_capnpPrivate::pointerCount;
-#endif
-#if !CAPNP_LITE
-constexpr ::capnp::Kind MinHash::LocusList::Locus::_capnpPrivate::kind;
-constexpr ::capnp::_::RawSchema const* MinHash::LocusList::Locus::_capnpPrivate::schema;
-constexpr ::capnp::_::RawBrandedSchema const* MinHash::LocusList::Locus::_capnpPrivate::brand;
-#endif  // !CAPNP_LITE
-
-
-}  // namespace
-
@@ -0,0 +1,605 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#include "cpuDispatch.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef CPU_DISPATCH_X86
+	#include <immintrin.h>
+#endif
+
+/* Array from 0..25 of DNA complement of A..Z */
+const char complement[] = {
+  'T', // 'A' = A
+  'V', // 'B' = not A = C,T,G
+  'G', // 'C' = C
+  'H', // 'D' = not C = A,T,G
+  'N', // 'E' = .
+  'N', // 'F' = .
+  'C', // 'G' = G
+  'D', // 'H' = not G = A,C,T
+  'N', // 'I' = .
+  'N', // 'J' = .
+  'M', // 'K' = T,G = Keto
+  'N', // 'L' = .
+  'K', // 'M' = A,C = Amino
+  'N', // 'N' = A,C,T,G = uNkNowN
+  'N', // 'O' = .
+  'N', // 'P' = .
+  'N', // 'Q' = .
+  'Y', // 'R' = A,G = puRine
+  'S', // 'S' = G,C = Strong
+  'A', // 'T' = T
+  'A', // 'U' = T (RNA)
+  'B', // 'V' = not T = A,C,G
+  'W', // 'W' = A,T = Weak
+  'N', // 'X' = .
+  'R', // 'Y' = pYrimidine = C,T
+  'N', // 'Z' = .
+};
+
+// Complement of every byte: letters use the table above, keeping their case,
+// and anything else becomes 'N'.
+//
+static const struct ComplementTable
+{
+	ComplementTable()
+	{
+		for ( int i = 0; i < 256; i++ )
+		{
+			int upper = i & ~32;
+			bases[i] = (upper >= 'A' && upper <= 'Z') ? complement[upper - 'A'] | (i & 32) : 'N';
+		}
+	}
+	
+	char bases[256];
+} complementTable;
+
+// Kernel bodies are written once and inlined into a wrapper per instruction
+// set, so the compiler can vectorize each for its target. Kernels that need
+// intrinsics have their own variants.
+
+#define KERNEL inline __attribute__((always_inline))
+
+static KERNEL void uppercaseBody(char * seq, uint64_t length)
+{
+	for ( uint64_t i = 0; i < length; i++ )
+	{
+		seq[i] -= (seq[i] > 96 && seq[i] < 123) ? 32 : 0;
+	}
+}
+
+static KERNEL void normalizeBody(char * seq, uint64_t length, bool uppercase, const bool * alphabet, uint64_t * valid)
+{
+	for ( uint64_t word = 0; word * 64 < length; word++ )
+	{
+		char * block = seq + word * 64;
+		uint64_t size = length - word * 64 < 64 ? length - word * 64 : 64;
+		uint64_t bits = 0;
+		
+		for ( uint64_t i = 0; i < size; i++ )
+		{
+			if ( uppercase && block[i] > 96 && block[i] < 123 )
+			{
+				block[i] -= 32;
+			}
+			
+			bits |= uint64_t(alphabet[(unsigned char)block[i]]) << i;
+		}
+		
+		valid[word] = bits;
+	}
+}
+
+static KERNEL void reverseComplementBody(const char * src, char * dest, int length)
+{
+	for ( int i = 0; i < length; i++ )
+	{
+		dest[i] = complementTable.bases[(unsigned char)src[length - i - 1]];
+	}
+}
+
+// The merges below can start part way through, from the state a block merge
+// leaves (see countSharedBlocks): hashes before i and j have been passed over
+// and common counts every match involving them.
+
+template <class T>
+static KERNEL void countSharedBody(const T * hashesRef, uint64_t sizeRef, const T * hashesQry, uint64_t sizeQry, uint64_t sketchSize, uint64_t commonMin, uint64_t i, uint64_t j, uint64_t common, uint64_t & commonOut, uint64_t & denomOut)
+{
+	// a match counted already has one side passed over and the other not, so
+	// subtracting it here leaves the hash counted once when the other side is
+	// merged below
+	//
+	uint64_t denom = i + j - common;
+	
+	// branchless merge; equal hashes advance both sides. Each step adds at
+	// most one to common, so it stops once even sharing every remaining hash
+	// would not reach commonMin.
+	//
+	while ( denom < sketchSize && i < sizeRef && j < sizeQry && common + sketchSize >= commonMin + denom )
+	{
+		T ref = hashesRef[i];
+		T qry = hashesQry[j];
+		
+		i += ref <= qry;
+		j += qry <= ref;
+		common += ref == qry;
+		denom++;
+	}
+	
+	if ( denom < sketchSize )
+	{
+		// complete the union operation if possible
+		
+		denom += (sizeRef - i) + (sizeQry - j);
+		
+		if ( denom > sketchSize )
+		{
+			denom = sketchSize;
+		}
+	}
+	
+	commonOut = common;
+	denomOut = denom;
+}
+
+template <class T>
+static KERNEL uint64_t countCommonBody(const T * hashesA, uint64_t sizeA, const T * hashesB, uint64_t sizeB, uint64_t i, uint64_t j, uint64_t common)
+{
+	while ( i < sizeA && j < sizeB )
+	{
+		T a = hashesA[i];
+		T b = hashesB[j];
+		
+		i += a <= b;
+		j += b <= a;
+		common += a == b;
+	}
+	
+	return common;
+}
+
+#define DEFINE_KERNELS(SUFFIX, ATTRIBUTES) \
+	ATTRIBUTES static void uppercase##SUFFIX(char * seq, uint64_t length) \
+		{uppercaseBody(seq, length);} \
+	static const CpuKernels kernels##SUFFIX = \
+	{ \
+		uppercase##SUFFIX, \
+		normalize##SUFFIX, \
+		reverseComplement##SUFFIX, \
+		countShared32##SUFFIX, \
+		countShared64##SUFFIX, \
+		countCommon32##SUFFIX, \
+		countCommon64##SUFFIX, \
+	};
+
+static void normalizeGeneric(char * seq, uint64_t length, bool uppercase, const bool * alphabet, uint64_t * valid)
+{
+	normalizeBody(seq, length, uppercase, alphabet, valid);
+}
+
+static void reverseComplementGeneric(const char * src, char * dest, int length)
+{
+	reverseComplementBody(src, dest, length);
+}
+
+static void countShared32Generic(const hash32_t * hashesRef, uint64_t sizeRef, const hash32_t * hashesQry, uint64_t sizeQry, uint64_t sketchSize, uint64_t commonMin, uint64_t & common, uint64_t & denom)
+{
+	countSharedBody(hashesRef, sizeRef, hashesQry, sizeQry, sketchSize, commonMin, 0, 0, 0, common, denom);
+}
+
+static void countShared64Generic(const hash64_t * hashesRef, uint64_t sizeRef, const hash64_t * hashesQry, uint64_t sizeQry, uint64_t sketchSize, uint64_t commonMin, uint64_t & common, uint64_t & denom)
+{
+	countSharedBody(hashesRef, sizeRef, hashesQry, sizeQry, sketchSize, commonMin, 0, 0, 0, common, denom);
+}
+
+static uint64_t countCommon32Generic(const hash32_t * hashesA, uint64_t sizeA, const hash32_t * hashesB, uint64_t sizeB)
+{
+	return countCommonBody(hashesA, sizeA, hashesB, sizeB, 0, 0, 0);
+}
+
+static uint64_t countCommon64Generic(const hash64_t * hashesA, uint64_t sizeA, const hash64_t * hashesB, uint64_t sizeB)
+{
+	return countCommonBody(hashesA, sizeA, hashesB, sizeB, 0, 0, 0);
+}
+
+DEFINE_KERNELS(Generic, )
+
+#ifdef CPU_DISPATCH_X86
+
+#define TARGET_AVX2 __attribute__((target("avx2,bmi,bmi2,popcnt")))
+#define TARGET_AVX512 __attribute__((target("avx2,bmi,bmi2,popcnt,avx512f,avx512bw,avx512dq,avx512vl")))
+
+// Alphabet membership for 16 bytes at a time with two shuffles: bit h of
+// nibblesLow[l] is set if the character with high nibble h and low nibble l
+// is in the alphabet, and nibblesHigh[h] is 1 << h. This covers ASCII; returns
+// false if the alphabet has characters above 127.
+//
+static bool setNibbleTables(const bool * alphabet, uint8_t * nibblesLow, uint8_t * nibblesHigh)
+{
+	for ( int i = 0; i < 16; i++ )
+	{
+		nibblesLow[i] = 0;
+		nibblesHigh[i] = i < 8 ? 1 << i : 0;
+	}
+	
+	for ( int i = 0; i < 256; i++ )
+	{
+		if ( alphabet[i] )
+		{
+			if ( i > 127 )
+			{
+				return false;
+			}
+			
+			nibblesLow[i & 15] |= 1 << (i >> 4);
+		}
+	}
+	
+	return true;
+}
+
+TARGET_AVX2 static void normalizeAVX2(char * seq, uint64_t length, bool uppercase, const bool * alphabet, uint64_t * valid)
+{
+	uint8_t nibblesLow[16];
+	uint8_t nibblesHigh[16];
+	
+	if ( ! setNibbleTables(alphabet, nibblesLow, nibblesHigh) )
+	{
+		normalizeBody(seq, length, uppercase, alphabet, valid);
+		return;
+	}
+	
+	const __m256i tableLow = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)nibblesLow));
+	const __m256i tableHigh = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)nibblesHigh));
+	const __m256i nibble = _mm256_set1_epi8(0x0f);
+	const __m256i beforeA = _mm256_set1_epi8('a' - 1);
+	const __m256i afterZ = _mm256_set1_epi8('z' + 1);
+	const __m256i caseBit = _mm256_set1_epi8(32);
+	
+	uint64_t i = 0;
+	
+	for ( ; i + 64 <= length; i += 64 )
+	{
+		uint64_t bits = 0;
+		
+		for ( int half = 0; half < 2; half++ )
+		{
+			__m256i * block = (__m256i *)(seq + i + half * 32);
+			__m256i chars = _mm256_loadu_si256(block);
+			
+			if ( uppercase )
+			{
+				// signed compares leave bytes above 127 alone
+				
+				__m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(chars, beforeA), _mm256_cmpgt_epi8(afterZ, chars));
+				chars = _mm256_sub_epi8(chars, _mm256_and_si256(lower, caseBit));
+				_mm256_storeu_si256(block, chars);
+			}
+			
+			__m256i low = _mm256_shuffle_epi8(tableLow, _mm256_and_si256(chars, nibble));
+			__m256i high = _mm256_shuffle_epi8(tableHigh, _mm256_and_si256(_mm256_srli_epi16(chars, 4), nibble));
+			__m256i invalid = _mm256_cmpeq_epi8(_mm256_and_si256(low, high), _mm256_setzero_si256());
+			
+			bits |= uint64_t(~uint32_t(_mm256_movemask_epi8(invalid))) << (half * 32);
+		}
+		
+		valid[i / 64] = bits;
+	}
+	
+	normalizeBody(seq + i, length - i, uppercase, alphabet, valid + i / 64);
+}
+
+TARGET_AVX512 static void normalizeAVX512(char * seq, uint64_t length, bool uppercase, const bool * alphabet, uint64_t * valid)
+{
+	uint8_t nibblesLow[16];
+	uint8_t nibblesHigh[16];
+	
+	if ( ! setNibbleTables(alphabet, nibblesLow, nibblesHigh) )
+	{
+		normalizeBody(seq, length, uppercase, alphabet, valid);
+		return;
+	}
+	
+	const __m512i tableLow = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)nibblesLow));
+	const __m512i tableHigh = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)nibblesHigh));
+	const __m512i nibble = _mm512_set1_epi8(0x0f);
+	const __m512i lowerA = _mm512_set1_epi8('a');
+	const __m512i lowerZ = _mm512_set1_epi8('z');
+	const __m512i caseBit = _mm512_set1_epi8(32);
+	
+	uint64_t i = 0;
+	
+	for ( ; i + 64 <= length; i += 64 )
+	{
+		__m512i chars = _mm512_loadu_si512(seq + i);
+		
+		if ( uppercase )
+		{
+			__mmask64 lower = _mm512_cmpge_epu8_mask(chars, lowerA) & _mm512_cmple_epu8_mask(chars, lowerZ);
+			chars = _mm512_mask_sub_epi8(chars, lower, chars, caseBit);
+			_mm512_storeu_si512(seq + i, chars);
+		}
+		
+		__m512i low = _mm512_shuffle_epi8(tableLow, _mm512_and_si512(chars, nibble));
+		__m512i high = _mm512_shuffle_epi8(tableHigh, _mm512_and_si512(_mm512_srli_epi16(chars, 4), nibble));
+		
+		valid[i / 64] = _mm512_test_epi8_mask(low, high);
+	}
+	
+	normalizeBody(seq + i, length - i, uppercase, alphabet, valid + i / 64);
+}
+
+// Reverse complement a vector at a time. Letters are folded to uppercase and
+// looked up in the 26-entry table with two shuffles (pshufb only uses the low
+// nibble of each index), then get their case bit back; non-letters become 'N'.
+
+static void setComplementTables(char * tableLow, char * tableHigh)
+{
+	for ( int i = 0; i < 16; i++ )
+	{
+		tableLow[i] = complement[i];
+		tableHigh[i] = i + 16 < 26 ? complement[i + 16] : 'N';
+	}
+}
+
+TARGET_AVX2 static void reverseComplementAVX2(const char * src, char * dest, int length)
+{
+	char complementLow[16];
+	char complementHigh[16];
+	
+	setComplementTables(complementLow, complementHigh);
+	
+	const __m256i tableLow = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)complementLow));
+	const __m256i tableHigh = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)complementHigh));
+	const __m256i reverse = _mm256_setr_epi8
+	(
+		15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+		15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+	);
+	const __m256i caseBit = _mm256_set1_epi8(32);
+	
+	int i = 0;
+	
+	for ( ; i + 32 <= length; i += 32 )
+	{
+		__m256i chars = _mm256_loadu_si256((const __m256i *)(src + length - i - 32));
+		__m256i index = _mm256_sub_epi8(_mm256_andnot_si256(caseBit, chars), _mm256_set1_epi8('A'));
+		
+		// signed compares; bytes above 127 give negative or large indices
+		
+		__m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(index, _mm256_set1_epi8(-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(26), index));
+		__m256i high = _mm256_cmpgt_epi8(index, _mm256_set1_epi8(15));
+		
+		__m256i bases = _mm256_blendv_epi8(_mm256_shuffle_epi8(tableLow, index), _mm256_shuffle_epi8(tableHigh, index), high);
+		bases = _mm256_or_si256(bases, _mm256_and_si256(chars, caseBit));
+		bases = _mm256_blendv_epi8(_mm256_set1_epi8('N'), bases, letter);
+		
+		// reverse bytes within each 128-bit lane, then swap the lanes
+		//
+		bases = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(bases, reverse), 0x4e);
+		
+		_mm256_storeu_si256((__m256i *)(dest + i), bases);
+	}
+	
+	reverseComplementBody(src, dest + i, length - i);
+}
+
+TARGET_AVX512 static void reverseComplementAVX512(const char * src, char * dest, int length)
+{
+	char complementLow[16];
+	char complementHigh[16];
+	
+	setComplementTables(complementLow, complementHigh);
+	
+	const __m512i tableLow = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)complementLow));
+	const __m512i tableHigh = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)complementHigh));
+	const __m512i reverse = _mm512_broadcast_i32x4(_mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+	const __m512i caseBit = _mm512_set1_epi8(32);
+	
+	int i = 0;
+	
+	for ( ; i + 64 <= length; i += 64 )
+	{
+		__m512i chars = _mm512_loadu_si512(src + length - i - 64);
+		__m512i index = _mm512_sub_epi8(_mm512_andnot_si512(caseBit, chars), _mm512_set1_epi8('A'));
+		
+		__mmask64 letter = _mm512_cmplt_epu8_mask(index, _mm512_set1_epi8(26));
+		__mmask64 high = _mm512_cmpge_epu8_mask(index, _mm512_set1_epi8(16));
+		
+		__m512i bases = _mm512_mask_blend_epi8(high, _mm512_shuffle_epi8(tableLow, index), _mm512_shuffle_epi8(tableHigh, index));
+		bases = _mm512_or_si512(bases, _mm512_and_si512(chars, caseBit));
+		bases = _mm512_mask_blend_epi8(letter, _mm512_set1_epi8('N'), bases);
+		
+		// reverse bytes within each 128-bit lane, then the order of the lanes
+		//
+		bases = _mm512_shuffle_epi8(bases, reverse);
+		bases = _mm512_shuffle_i64x2(bases, bases, 0x1b);
+		
+		_mm512_storeu_si512(dest + i, bases);
+	}
+	
+	reverseComplementBody(src, dest + i, length - i);
+}
+
+// Sorted hash lists are merged a block (one vector) of each at a time: every
+// hash of one block is compared to every hash of the other by rotating it,
+// and the list whose block ends lower (or both) moves on to its next block.
+// Hashes are unique within a list, so each match is found in exactly one pair
+// of blocks. The 512-bit variants use the same 256-bit blocks, which are the
+// better size for sketches of a few thousand hashes.
+
+TARGET_AVX2 static KERNEL uint64_t countBlockMatches(const hash32_t * hashesA, const hash32_t * hashesB)
+{
+	const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+	
+	__m256i blockA = _mm256_loadu_si256((const __m256i *)hashesA);
+	__m256i blockB = _mm256_loadu_si256((const __m256i *)hashesB);
+	__m256i matches = _mm256_cmpeq_epi32(blockA, blockB);
+	
+	for ( int i = 1; i < 8; i++ )
+	{
+		blockB = _mm256_permutevar8x32_epi32(blockB, rotate);
+		matches = _mm256_or_si256(matches, _mm256_cmpeq_epi32(blockA, blockB));
+	}
+	
+	return _mm_popcnt_u32(_mm256_movemask_ps(_mm256_castsi256_ps(matches)));
+}
+
+TARGET_AVX2 static KERNEL uint64_t countBlockMatches(const hash64_t * hashesA, const hash64_t * hashesB)
+{
+	__m256i blockA = _mm256_loadu_si256((const __m256i *)hashesA);
+	__m256i blockB = _mm256_loadu_si256((const __m256i *)hashesB);
+	__m256i matches = _mm256_cmpeq_epi64(blockA, blockB);
+	
+	matches = _mm256_or_si256(matches, _mm256_cmpeq_epi64(blockA, _mm256_permute4x64_epi64(blockB, 0x39)));
+	matches = _mm256_or_si256(matches, _mm256_cmpeq_epi64(blockA, _mm256_permute4x64_epi64(blockB, 0x4e)));
+	matches = _mm256_or_si256(matches, _mm256_cmpeq_epi64(blockA, _mm256_permute4x64_epi64(blockB, 0x93)));
+	
+	return _mm_popcnt_u32(_mm256_movemask_pd(_mm256_castsi256_pd(matches)));
+}
+
+// Block merge for as long as it cannot pass the bottom sketchSize hashes of
+// the union, then the scalar merge for the rest. Hashes up to the last one
+// passed over all lie within a block of i and j, so while i + j + 2 * block
+// (after the next step) stays within the sketch size, everything passed over
+// is in the bottom hashes. The scalar merge would start from a denominator
+// of i + j - matches, which bounds the shared count for stopping early.
+//
+template <class T>
+TARGET_AVX2 static KERNEL void countSharedBlocks(const T * hashesRef, uint64_t sizeRef, const T * hashesQry, uint64_t sizeQry, uint64_t sketchSize, uint64_t commonMin, uint64_t & common, uint64_t & denom)
+{
+	const uint64_t block = 32 / sizeof(T);
+	
+	uint64_t i = 0;
+	uint64_t j = 0;
+	uint64_t matches = 0;
+	
+	while ( i + block <= sizeRef && j + block <= sizeQry && i + j + 4 * block <= sketchSize && 2 * matches + sketchSize >= commonMin + i + j )
+	{
+		matches += countBlockMatches(hashesRef + i, hashesQry + j);
+		
+		T lastRef = hashesRef[i + block - 1];
+		T lastQry = hashesQry[j + block - 1];
+		
+		i += lastRef <= lastQry ? block : 0;
+		j += lastQry <= lastRef ? block : 0;
+	}
+	
+	countSharedBody(hashesRef, sizeRef, hashesQry, sizeQry, sketchSize, commonMin, i, j, matches, common, denom);
+}
+
+template <class T>
+TARGET_AVX2 static KERNEL uint64_t countCommonBlocks(const T * hashesA, uint64_t sizeA, const T * hashesB, uint64_t sizeB)
+{
+	const uint64_t block = 32 / sizeof(T);
+	
+	uint64_t i = 0;
+	uint64_t j = 0;
+	uint64_t matches = 0;
+	
+	while ( i + block <= sizeA && j + block <= sizeB )
+	{
+		matches += countBlockMatches(hashesA + i, hashesB + j);
+		
+		T lastA = hashesA[i + block - 1];
+		T lastB = hashesB[j + block - 1];
+		
+		i += lastA <= lastB ? block : 0;
+		j += lastB <= lastA ? block : 0;
+	}
+	
+	return countCommonBody(hashesA, sizeA, hashesB, sizeB, i, j, matches);
+}
+
+#define DEFINE_MERGE_KERNELS(SUFFIX, ATTRIBUTES) \
+	ATTRIBUTES static void countShared32##SUFFIX(const hash32_t * hashesRef, uint64_t sizeRef, const hash32_t * hashesQry, uint64_t sizeQry, uint64_t sketchSize, uint64_t commonMin, uint64_t & common, uint64_t & denom) \
+		{countSharedBlocks(hashesRef, sizeRef, hashesQry, sizeQry, sketchSize, commonMin, common, denom);} \
+	ATTRIBUTES static void countShared64##SUFFIX(const hash64_t * hashesRef, uint64_t sizeRef, const hash64_t * hashesQry, uint64_t sizeQry, uint64_t sketchSize, uint64_t commonMin, uint64_t & common, uint64_t & denom) \
+		{countSharedBlocks(hashesRef, sizeRef, hashesQry, sizeQry, sketchSize, commonMin, common, denom);} \
+	ATTRIBUTES static uint64_t countCommon32##SUFFIX(const hash32_t * hashesA, uint64_t sizeA, const hash32_t * hashesB, uint64_t sizeB) \
+		{return countCommonBlocks(hashesA, sizeA, hashesB, sizeB);} \
+	ATTRIBUTES static uint64_t countCommon64##SUFFIX(const hash64_t * hashesA, uint64_t sizeA, const hash64_t * hashesB, uint64_t sizeB) \
+		{return countCommonBlocks(hashesA, sizeA, hashesB, sizeB);}
+
+DEFINE_MERGE_KERNELS(AVX2, TARGET_AVX2)
+DEFINE_MERGE_KERNELS(AVX512, TARGET_AVX512)
+
+DEFINE_KERNELS(AVX2, TARGET_AVX2)
+DEFINE_KERNELS(AVX512, TARGET_AVX512)
+
+#endif
+
+static CpuVariant detectCpuVariant()
+{
+	CpuVariant variant = cpuVariantGeneric;
+
+#ifdef CPU_DISPATCH_X86
+	__builtin_cpu_init();
+	
+	if ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2") )
+	{
+		variant = cpuVariantAVX2;
+		
+		if
+		(
+			__builtin_cpu_supports("avx512f") &&
+			__builtin_cpu_supports("avx512bw") &&
+			__builtin_cpu_supports("avx512dq") &&
+			__builtin_cpu_supports("avx512vl")
+		)
+		{
+			variant = cpuVariantAVX512;
+		}
+	}
+#endif
+
+	const char * cap = getenv("MASH_CPU");
+	
+	if ( cap != 0 )
+	{
+		for ( int i = cpuVariantGeneric; i < variant; i++ )
+		{
+			if ( strcmp(cap, getCpuVariantName(CpuVariant(i))) == 0 )
+			{
+				variant = CpuVariant(i);
+				break;
+			}
+		}
+	}
+	
+	return variant;
+}
+
+CpuVariant getCpuVariant()
+{
+	static const CpuVariant variant = detectCpuVariant();
+	
+	return variant;
+}
+
+const char * getCpuVariantName(CpuVariant variant)
+{
+	switch ( variant )
+	{
+		case cpuVariantAVX2: return "avx2";
+		case cpuVariantAVX512: return "avx512";
+		default: return "generic";
+	}
+}
+
+const CpuKernels & getCpuKernels()
+{
+	static const CpuKernels & kernels =
+#ifdef CPU_DISPATCH_X86
+		getCpuVariant() == cpuVariantAVX512 ? kernelsAVX512 :
+		getCpuVariant() == cpuVariantAVX2 ? kernelsAVX2 :
+#endif
+		kernelsGeneric;
+	
+	return kernels;
+}
@@ -0,0 +1,92 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#ifndef cpuDispatch_h
+#define cpuDispatch_h
+
+#include "hash.h"
+
+#if defined(__x86_64__) && ! defined(ARCH_32) && defined(__GNUC__)
+	#define CPU_DISPATCH_X86
+#endif
+
+// Hot kernels are built for several instruction sets and the best one the
+// host supports is picked once, on first use, from CPUID. Setting MASH_CPU to
+// "generic", "avx2" or "avx512" caps the choice (for testing).
+//
+enum CpuVariant
+{
+	cpuVariantGeneric,
+	cpuVariantAVX2,
+	cpuVariantAVX512
+};
+
+struct CpuKernels
+{
+	// uppercase a-z in place
+	//
+	void (* uppercase)(char * seq, uint64_t length);
+	
+	// uppercase a-z in place (if requested) and set bit i of valid, which
+	// must hold (length + 63) / 64 words, if position i is in the alphabet
+	//
+	void (* normalize)(char * seq, uint64_t length, bool uppercase, const bool * alphabet, uint64_t * valid);
+	
+	// IUPAC reverse complement; letters keep their case and anything else
+	// becomes 'N'
+	//
+	void (* reverseComplement)(const char * src, char * dest, int length);
+	
+	// shared hashes and union size of the bottom sketchSize hashes of two
+	// sorted hash lists. If fewer than commonMin hashes turn out to be shared,
+	// the merge may stop early, leaving partial counts (with common still
+	// below commonMin).
+	//
+	void (* countShared32)(const hash32_t * hashesRef, uint64_t sizeRef, const hash32_t * hashesQry, uint64_t sizeQry, uint64_t sketchSize, uint64_t commonMin, uint64_t & common, uint64_t & denom);
+	void (* countShared64)(const hash64_t * hashesRef, uint64_t sizeRef, const hash64_t * hashesQry, uint64_t sizeQry, uint64_t sketchSize, uint64_t commonMin, uint64_t & common, uint64_t & denom);
+	
+	// size of the intersection of two sorted hash lists
+	//
+	uint64_t (* countCommon32)(const hash32_t * hashesA, uint64_t sizeA, const hash32_t * hashesB, uint64_t sizeB);
+	uint64_t (* countCommon64)(const hash64_t * hashesA, uint64_t sizeA, const hash64_t * hashesB, uint64_t sizeB);
+};
+
+// Position of the first bit in [pos, end) of a bitmap that is set (or clear,
+// if set is false), or end if there is none.
+//
+inline uint64_t findBit(const uint64_t * bits, uint64_t pos, uint64_t end, bool set)
+{
+	if ( pos >= end )
+	{
+		return end;
+	}
+	
+	uint64_t flip = set ? 0 : ~uint64_t(0);
+	uint64_t word = pos / 64;
+	uint64_t remaining = (bits[word] ^ flip) & (~uint64_t(0) << (pos % 64));
+	
+	while ( remaining == 0 )
+	{
+		word++;
+		
+		if ( word * 64 >= end )
+		{
+			return end;
+		}
+		
+		remaining = bits[word] ^ flip;
+	}
+	
+	uint64_t found = word * 64 + __builtin_ctzll(remaining);
+	
+	return found < end ? found : end;
+}
+
+CpuVariant getCpuVariant();
+const char * getCpuVariantName(CpuVariant variant);
+const CpuKernels & getCpuKernels();
+
+#endif
@@ -6,6 +6,12 @@
 
 #include "hash.h"
 #include "MurmurHash3.h"
+#include "cpuDispatch.h"
+#include <string.h>
+
+#ifdef CPU_DISPATCH_X86
+	#include <immintrin.h>
+#endif
 
 hash_u getHash(const char * seq, int length, uint32_t seed, bool use64)
 {
@@ -37,6 +43,383 @@ hash_u getHash(const char * seq, int length, uint32_t seed, bool use64)
     return hash;
 }
 
+const char * getHashFunctionName(HashFunction hashFunction)
+{
+    switch ( hashFunction )
+    {
+        case hashFunctionNtHash: return "ntHash";
+#ifdef ARCH_32
+        default: return "MurmurHash3_x86_32";
+#else
+        default: return "MurmurHash3_x64_128";
+#endif
+    }
+}
+
+#ifdef CPU_DISPATCH_X86
+
+// MurmurHash3_x64_128 over four keys at once, one per 64-bit lane. AVX2 has no
+// 64-bit multiply, so it is built from three 32-bit ones.
+
+__attribute__((target("avx2")))
+static inline __m256i mul64(__m256i a, __m256i b)
+{
+	__m256i lo = _mm256_mul_epu32(a, b);
+	__m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+	
+	return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i rotl64(__m256i x, int r)
+{
+	return _mm256_or_si256(_mm256_slli_epi64(x, r), _mm256_srli_epi64(x, 64 - r));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i fmix64(__m256i k)
+{
+	k = _mm256_xor_si256(k, _mm256_srli_epi64(k, 33));
+	k = mul64(k, _mm256_set1_epi64x(0xff51afd7ed558ccdLLU));
+	k = _mm256_xor_si256(k, _mm256_srli_epi64(k, 33));
+	k = mul64(k, _mm256_set1_epi64x(0xc4ceb9fe1a85ec53LLU));
+	k = _mm256_xor_si256(k, _mm256_srli_epi64(k, 33));
+	
+	return k;
+}
+
+static inline uint64_t load64(const char * data)
+{
+	uint64_t value;
+	memcpy(&value, data, 8);
+	return value;
+}
+
+__attribute__((target("avx2")))
+static inline __m256i loadLanes(const char * const * seqs, int offset)
+{
+	return _mm256_set_epi64x(load64(seqs[3] + offset), load64(seqs[2] + offset), load64(seqs[1] + offset), load64(seqs[0] + offset));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i loadTail(const char * const * seqs, int end, int bytes)
+{
+	// The last 'bytes' (1-8) bytes before 'end', zero-extended as the
+	// MurmurHash3 tail reads them. Loads 8 bytes ending at 'end' and shifts,
+	// so keys must be at least 8 bytes long.
+	
+	return _mm256_srl_epi64(loadLanes(seqs, end - 8), _mm_cvtsi32_si128((8 - bytes) * 8));
+}
+
+template <int lengthFixed>
+__attribute__((target("avx2")))
+static inline void hashLanes(const char * const * seqs, int lengthRuntime, uint32_t seed, bool use64, hash_u * hashes)
+{
+	// a nonzero lengthFixed lets the block loop and tail be resolved at
+	// compile time
+	//
+	const int length = lengthFixed ? lengthFixed : lengthRuntime;
+	
+	const __m256i c1 = _mm256_set1_epi64x(0x87c37b91114253d5LLU);
+	const __m256i c2 = _mm256_set1_epi64x(0x4cf5ad432745937fLLU);
+	
+	__m256i h1 = _mm256_set1_epi64x(seed);
+	__m256i h2 = h1;
+	__m256i k1;
+	__m256i k2;
+	
+	int blocks = length / 16;
+	int tail = length & 15;
+	
+	for ( int i = 0; i < blocks; i++ )
+	{
+		int offset = i * 16;
+		
+		k1 = loadLanes(seqs, offset);
+		k2 = loadLanes(seqs, offset + 8);
+		
+		k1 = mul64(rotl64(mul64(k1, c1), 31), c2);
+		h1 = _mm256_xor_si256(h1, k1);
+		h1 = _mm256_add_epi64(rotl64(h1, 27), h2);
+		h1 = _mm256_add_epi64(_mm256_add_epi64(_mm256_slli_epi64(h1, 2), h1), _mm256_set1_epi64x(0x52dce729));
+		
+		k2 = mul64(rotl64(mul64(k2, c2), 33), c1);
+		h2 = _mm256_xor_si256(h2, k2);
+		h2 = _mm256_add_epi64(rotl64(h2, 31), h1);
+		h2 = _mm256_add_epi64(_mm256_add_epi64(_mm256_slli_epi64(h2, 2), h2), _mm256_set1_epi64x(0x38495ab5));
+	}
+	
+	int offset = blocks * 16;
+	
+	if ( tail > 8 )
+	{
+		k2 = loadTail(seqs, length, tail - 8);
+		k2 = mul64(rotl64(mul64(k2, c2), 33), c1);
+		h2 = _mm256_xor_si256(h2, k2);
+	}
+	
+	if ( tail > 0 )
+	{
+		int tail1 = tail > 8 ? 8 : tail;
+		
+		k1 = loadTail(seqs, offset + tail1, tail1);
+		k1 = mul64(rotl64(mul64(k1, c1), 31), c2);
+		h1 = _mm256_xor_si256(h1, k1);
+	}
+	
+	__m256i len = _mm256_set1_epi64x(length);
+	
+	h1 = _mm256_xor_si256(h1, len);
+	h2 = _mm256_xor_si256(h2, len);
+	
+	h1 = _mm256_add_epi64(h1, h2);
+	h2 = _mm256_add_epi64(h2, h1);
+	
+	h1 = fmix64(h1);
+	h2 = fmix64(h2);
+	
+	// only the first 64 bits are used for hashes
+	//
+	h1 = _mm256_add_epi64(h1, h2);
+	
+	uint64_t out[4];
+	_mm256_storeu_si256((__m256i *)out, h1);
+	
+	for ( int i = 0; i < 4; i++ )
+	{
+		if ( use64 )
+		{
+			hashes[i].hash64 = out[i];
+		}
+		else
+		{
+			hashes[i].hash32 = out[i];
+		}
+	}
+}
+
+template <int lengthFixed>
+__attribute__((target("avx2")))
+static void getHashesAVX2(const char * const * seqs, int count, int length, uint32_t seed, bool use64, hash_u * hashes)
+{
+	int i = 0;
+	
+	for ( ; i + 4 <= count; i += 4 )
+	{
+		hashLanes<lengthFixed>(seqs + i, length, seed, use64, hashes + i);
+	}
+	
+	if ( i < count )
+	{
+		// pad the last group by repeating its first key
+		
+		const char * seqsLast[4];
+		hash_u hashesLast[4];
+		
+		for ( int j = 0; j < 4; j++ )
+		{
+			seqsLast[j] = seqs[i + j < count ? i + j : i];
+		}
+		
+		hashLanes<lengthFixed>(seqsLast, length, seed, use64, hashesLast);
+		
+		for ( int j = 0; i + j < count; j++ )
+		{
+			hashes[i + j] = hashesLast[j];
+		}
+	}
+}
+
+// The same over eight keys with AVX-512, which has native 64-bit multiplies
+// and rotates.
+
+#define AVX512 __attribute__((target("avx512f,avx512dq")))
+
+template <int r>
+AVX512 static inline __m512i rotl512(__m512i x)
+{
+	return _mm512_rol_epi64(x, r);
+}
+
+AVX512 static inline __m512i fmix512(__m512i k)
+{
+	k = _mm512_xor_si512(k, _mm512_srli_epi64(k, 33));
+	k = _mm512_mullo_epi64(k, _mm512_set1_epi64(0xff51afd7ed558ccdLLU));
+	k = _mm512_xor_si512(k, _mm512_srli_epi64(k, 33));
+	k = _mm512_mullo_epi64(k, _mm512_set1_epi64(0xc4ceb9fe1a85ec53LLU));
+	k = _mm512_xor_si512(k, _mm512_srli_epi64(k, 33));
+	
+	return k;
+}
+
+AVX512 static inline __m512i loadLanes512(const char * const * seqs, int offset)
+{
+	return _mm512_set_epi64
+	(
+		load64(seqs[7] + offset), load64(seqs[6] + offset), load64(seqs[5] + offset), load64(seqs[4] + offset),
+		load64(seqs[3] + offset), load64(seqs[2] + offset), load64(seqs[1] + offset), load64(seqs[0] + offset)
+	);
+}
+
+AVX512 static inline __m512i loadTail512(const char * const * seqs, int end, int bytes)
+{
+	return _mm512_srl_epi64(loadLanes512(seqs, end - 8), _mm_cvtsi32_si128((8 - bytes) * 8));
+}
+
+template <int lengthFixed>
+AVX512 static inline void hashLanes512(const char * const * seqs, int lengthRuntime, uint32_t seed, bool use64, hash_u * hashes)
+{
+	const int length = lengthFixed ? lengthFixed : lengthRuntime;
+	
+	const __m512i c1 = _mm512_set1_epi64(0x87c37b91114253d5LLU);
+	const __m512i c2 = _mm512_set1_epi64(0x4cf5ad432745937fLLU);
+	
+	__m512i h1 = _mm512_set1_epi64(seed);
+	__m512i h2 = h1;
+	__m512i k1;
+	__m512i k2;
+	
+	int blocks = length / 16;
+	int tail = length & 15;
+	
+	for ( int i = 0; i < blocks; i++ )
+	{
+		int offset = i * 16;
+		
+		k1 = loadLanes512(seqs, offset);
+		k2 = loadLanes512(seqs, offset + 8);
+		
+		k1 = _mm512_mullo_epi64(rotl512<31>(_mm512_mullo_epi64(k1, c1)), c2);
+		h1 = _mm512_xor_si512(h1, k1);
+		h1 = _mm512_add_epi64(rotl512<27>(h1), h2);
+		h1 = _mm512_add_epi64(_mm512_add_epi64(_mm512_slli_epi64(h1, 2), h1), _mm512_set1_epi64(0x52dce729));
+		
+		k2 = _mm512_mullo_epi64(rotl512<33>(_mm512_mullo_epi64(k2, c2)), c1);
+		h2 = _mm512_xor_si512(h2, k2);
+		h2 = _mm512_add_epi64(rotl512<31>(h2), h1);
+		h2 = _mm512_add_epi64(_mm512_add_epi64(_mm512_slli_epi64(h2, 2), h2), _mm512_set1_epi64(0x38495ab5));
+	}
+	
+	int offset = blocks * 16;
+	
+	if ( tail > 8 )
+	{
+		k2 = loadTail512(seqs, length, tail - 8);
+		k2 = _mm512_mullo_epi64(rotl512<33>(_mm512_mullo_epi64(k2, c2)), c1);
+		h2 = _mm512_xor_si512(h2, k2);
+	}
+	
+	if ( tail > 0 )
+	{
+		int tail1 = tail > 8 ? 8 : tail;
+		
+		k1 = loadTail512(seqs, offset + tail1, tail1);
+		k1 = _mm512_mullo_epi64(rotl512<31>(_mm512_mullo_epi64(k1, c1)), c2);
+		h1 = _mm512_xor_si512(h1, k1);
+	}
+	
+	__m512i len = _mm512_set1_epi64(length);
+	
+	h1 = _mm512_xor_si512(h1, len);
+	h2 = _mm512_xor_si512(h2, len);
+	
+	h1 = _mm512_add_epi64(h1, h2);
+	h2 = _mm512_add_epi64(h2, h1);
+	
+	h1 = fmix512(h1);
+	h2 = fmix512(h2);
+	
+	h1 = _mm512_add_epi64(h1, h2);
+	
+	uint64_t out[8];
+	_mm512_storeu_si512(out, h1);
+	
+	for ( int i = 0; i < 8; i++ )
+	{
+		if ( use64 )
+		{
+			hashes[i].hash64 = out[i];
+		}
+		else
+		{
+			hashes[i].hash32 = out[i];
+		}
+	}
+}
+
+template <int lengthFixed>
+AVX512 static void getHashesAVX512(const char * const * seqs, int count, int length, uint32_t seed, bool use64, hash_u * hashes)
+{
+	int i = 0;
+	
+	for ( ; i + 8 <= count; i += 8 )
+	{
+		hashLanes512<lengthFixed>(seqs + i, length, seed, use64, hashes + i);
+	}
+	
+	if ( i < count )
+	{
+		// pad the last group by repeating its first key
+		
+		const char * seqsLast[8];
+		hash_u hashesLast[8];
+		
+		for ( int j = 0; j < 8; j++ )
+		{
+			seqsLast[j] = seqs[i + j < count ? i + j : i];
+		}
+		
+		hashLanes512<lengthFixed>(seqsLast, length, seed, use64, hashesLast);
+		
+		for ( int j = 0; i + j < count; j++ )
+		{
+			hashes[i + j] = hashesLast[j];
+		}
+	}
+}
+
+template <int lengthFixed>
+static void getHashesFixed(const char * const * seqs, int count, int length, uint32_t seed, bool use64, hash_u * hashes)
+{
+	if ( getCpuVariant() == cpuVariantAVX512 )
+	{
+		getHashesAVX512<lengthFixed>(seqs, count, length, seed, use64, hashes);
+	}
+	else
+	{
+		getHashesAVX2<lengthFixed>(seqs, count, length, seed, use64, hashes);
+	}
+}
+
+#endif
+
+void getHashes(const char * const * seqs, int count, int length, uint32_t seed, bool use64, hash_u * hashes)
+{
+#ifdef CPU_DISPATCH_X86
+	if ( getCpuVariant() != cpuVariantGeneric && length >= 8 )
+	{
+		// common k-mer sizes get their own unrolled kernels
+		
+		switch ( length )
+		{
+			case 15: getHashesFixed<15>(seqs, count, length, seed, use64, hashes); break;
+			case 16: getHashesFixed<16>(seqs, count, length, seed, use64, hashes); break;
+			case 21: getHashesFixed<21>(seqs, count, length, seed, use64, hashes); break;
+			case 31: getHashesFixed<31>(seqs, count, length, seed, use64, hashes); break;
+			case 32: getHashesFixed<32>(seqs, count, length, seed, use64, hashes); break;
+			default: getHashesFixed<0>(seqs, count, length, seed, use64, hashes);
+		}
+		
+		return;
+	}
+#endif
+
+	for ( int i = 0; i < count; i++ )
+	{
+		hashes[i] = getHash(seqs[i], length, seed, use64);
+	}
+}
+
 bool hashLessThan(hash_u hash1, hash_u hash2, bool use64)
 {
     if ( use64 )
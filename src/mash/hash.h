@@ -18,7 +18,22 @@ union hash_u
     hash64_t hash64;
 };
 
+// Hash families a sketch can be built with; stored in sketch files
+//
+enum HashFunction
+{
+    hashFunctionMurmur3,
+    hashFunctionNtHash
+};
+
+// Number of k-mers callers should gather before calling getHashes, enough to
+// keep the vector lanes busy without holding much on the stack.
+//
+static const int hashBatchSize = 64;
+
 hash_u getHash(const char * seq, int length, uint32_t seed, bool use64);
+const char * getHashFunctionName(HashFunction hashFunction);
+void getHashes(const char * const * seqs, int count, int length, uint32_t seed, bool use64, hash_u * hashes);
 bool hashLessThan(hash_u hash1, hash_u hash2, bool use64);
 
 #endif
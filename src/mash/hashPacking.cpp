@@ -0,0 +1,230 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#include "hashPacking.h"
+#include <string.h>
+
+using std::vector;
+
+static uint64_t loadWord(const uint8_t * bytes)
+{
+	uint64_t word;
+	memcpy(&word, bytes, sizeof(word));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	word = __builtin_bswap64(word);
+#endif
+
+	return word;
+}
+
+static void storeWord(uint8_t * bytes, uint64_t word)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	word = __builtin_bswap64(word);
+#endif
+
+	memcpy(bytes, &word, sizeof(word));
+}
+
+template <typename T>
+static void packHashesT(const T * hashes, uint64_t count, vector<uint8_t> & packed)
+{
+	uint64_t blocks = count > 1 ? (count - 1 + hashPackingBlockSize - 1) / hashPackingBlockSize : 0;
+	uint64_t widthBytes = (blocks + 7) / 8 * 8;
+	
+	vector<uint8_t> widths(widthBytes, 0);
+	uint64_t wordCount = 1;
+	
+	for ( uint64_t i = 0; i < blocks; i++ )
+	{
+		uint64_t start = i * hashPackingBlockSize + 1;
+		uint64_t end = start + hashPackingBlockSize < count ? start + hashPackingBlockSize : count;
+		uint64_t maximum = 0;
+		
+		for ( uint64_t j = start; j < end; j++ )
+		{
+			maximum |= (uint64_t)(hashes[j] - hashes[j - 1]);
+		}
+		
+		widths[i] = maximum ? 64 - __builtin_clzll(maximum) : 0;
+		wordCount += widths[i];
+	}
+	
+	packed.assign(16 + widthBytes + wordCount * 8, 0);
+	
+	uint8_t * bytes = packed.data();
+	
+	storeWord(bytes, count);
+	storeWord(bytes + 8, count ? hashes[0] : 0);
+	
+	if ( widthBytes )
+	{
+		memcpy(bytes + 16, widths.data(), widthBytes);
+	}
+	
+	uint8_t * words = bytes + 16 + widthBytes;
+	vector<uint64_t> blockWords(65);
+	
+	for ( uint64_t i = 0; i < blocks; i++ )
+	{
+		int width = widths[i];
+		uint64_t start = i * hashPackingBlockSize + 1;
+		uint64_t end = start + hashPackingBlockSize < count ? start + hashPackingBlockSize : count;
+		
+		blockWords.assign(width + 1, 0);
+		
+		for ( uint64_t j = start; j < end; j++ )
+		{
+			uint64_t delta = hashes[j] - hashes[j - 1];
+			uint64_t bit = (j - start) * width;
+			uint64_t shift = bit & 63;
+			
+			blockWords[bit >> 6] |= delta << shift;
+			
+			if ( shift + width > 64 )
+			{
+				blockWords[(bit >> 6) + 1] |= delta >> (64 - shift);
+			}
+		}
+		
+		for ( int j = 0; j < width; j++ )
+		{
+			storeWord(words + j * 8, blockWords[j]);
+		}
+		
+		words += width * 8;
+	}
+}
+
+template <typename T>
+static bool unpackHashesT(const uint8_t * packed, uint64_t size, uint64_t countMax, T * hashes)
+{
+	uint64_t count = loadWord(packed);
+	uint64_t blocks = count > 1 ? (count - 1 + hashPackingBlockSize - 1) / hashPackingBlockSize : 0;
+	uint64_t widthBytes = (blocks + 7) / 8 * 8;
+	
+	const uint8_t * widths = packed + 16;
+	const uint8_t * words = widths + widthBytes;
+	const uint8_t * end = packed + size;
+	
+	if ( countMax > count )
+	{
+		countMax = count;
+	}
+	
+	if ( countMax == 0 )
+	{
+		return true;
+	}
+	
+	T previous = loadWord(packed + 8);
+	hashes[0] = previous;
+	
+	uint64_t blockWords[66];
+	uint64_t deltas[hashPackingBlockSize];
+	
+	for ( uint64_t i = 0; i * hashPackingBlockSize + 1 < countMax; i++ )
+	{
+		int width = widths[i];
+		
+		if ( width > 64 || words + (width + 1) * 8 > end )
+		{
+			return false;
+		}
+		
+		for ( int j = 0; j <= width; j++ )
+		{
+			blockWords[j] = loadWord(words + j * 8);
+		}
+		
+		blockWords[width + 1] = 0; // read (and masked off) when width is 0
+		
+		// branch-free for every width, so it vectorizes; bits past a value's
+		// width (from the next word or block) are masked off
+		//
+		uint64_t mask = width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+		
+		for ( int j = 0; j < hashPackingBlockSize; j++ )
+		{
+			uint64_t bit = uint64_t(j) * width;
+			uint64_t shift = bit & 63;
+			uint64_t low = blockWords[bit >> 6] >> shift;
+			uint64_t high = (blockWords[(bit >> 6) + 1] << 1) << (63 - shift);
+			
+			deltas[j] = (low | high) & mask;
+		}
+		
+		uint64_t start = i * hashPackingBlockSize + 1;
+		uint64_t n = countMax - start < hashPackingBlockSize ? countMax - start : hashPackingBlockSize;
+		
+		for ( uint64_t j = 0; j < n; j++ )
+		{
+			previous += deltas[j];
+			hashes[start + j] = previous;
+		}
+		
+		words += width * 8;
+	}
+	
+	return true;
+}
+
+void packHashes(const HashList & hashes, vector<uint8_t> & packed)
+{
+	if ( hashes.get64() )
+	{
+		packHashesT(hashes.data<hash64_t>(), hashes.size(), packed);
+	}
+	else
+	{
+		packHashesT(hashes.data<hash32_t>(), hashes.size(), packed);
+	}
+}
+
+bool unpackHashes(const uint8_t * packed, uint64_t size, bool use64, uint64_t countMax, HashList & hashes)
+{
+	hashes.clear();
+	hashes.setUse64(use64);
+	
+	if ( size < 16 )
+	{
+		return false;
+	}
+	
+	uint64_t count = loadWord(packed);
+	uint64_t blocks = count > 1 ? (count - 1 + hashPackingBlockSize - 1) / hashPackingBlockSize : 0;
+	
+	if ( blocks > size || 16 + (blocks + 7) / 8 * 8 + 8 > size )
+	{
+		return false;
+	}
+	
+	if ( countMax > count )
+	{
+		countMax = count;
+	}
+	
+	hashes.resize(countMax);
+	
+	bool valid;
+	
+	if ( use64 )
+	{
+		valid = unpackHashesT(packed, size, countMax, hashes.data<hash64_t>());
+	}
+	else
+	{
+		valid = unpackHashesT(packed, size, countMax, hashes.data<hash32_t>());
+	}
+	
+	if ( ! valid )
+	{
+		hashes.clear();
+	}
+	
+	return valid;
+}
@@ -0,0 +1,38 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#ifndef hashPacking_h
+#define hashPacking_h
+
+#include "HashList.h"
+#include <vector>
+
+// Sorted hashes stored as the first hash and the deltas between neighbors,
+// bit-packed in blocks of 64 deltas with one width per block:
+//
+//   uint64_t  count
+//   uint64_t  first hash
+//   uint8_t   widths[blocks], padded to a multiple of 8 bytes
+//   uint64_t  words[sum of widths + 1]
+//
+// Each block takes exactly its width in words. The last word is padding, so
+// unpacking can always read the word after a value without checking. All
+// values are little-endian.
+//
+// Sketch files record which version of this encoding they use; readers
+// refuse versions newer than hashEncodingVersion.
+//
+static const uint32_t hashEncodingVersion = 1;
+static const int hashPackingBlockSize = 64;
+
+void packHashes(const HashList & hashes, std::vector<uint8_t> & packed);
+
+// Returns false if the data is malformed. At most countMax hashes are
+// unpacked.
+//
+bool unpackHashes(const uint8_t * packed, uint64_t size, bool use64, uint64_t countMax, HashList & hashes);
+
+#endif
@@ -0,0 +1,34 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#include "ntHash.h"
+
+static const uint64_t seedA = 0x3c8bfbb395c60474LLU;
+static const uint64_t seedC = 0x3193c18562a02b4cLLU;
+static const uint64_t seedG = 0x20323ed082572324LLU;
+static const uint64_t seedT = 0x295549f54be24456LLU;
+
+#define NTHASH_SEEDS(A, C, G, T) \
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, \
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, \
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, \
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, \
+	0, A, 0, C, 0, 0, 0, G, 0, 0, 0, 0, 0, 0, 0, 0, \
+	0, 0, 0, 0, T, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+
+const uint64_t ntHashSeeds[256] = {NTHASH_SEEDS(seedA, seedC, seedG, seedT)};
+const uint64_t ntHashSeedsComplement[256] = {NTHASH_SEEDS(seedT, seedG, seedC, seedA)};
+
+NtHash::NtHash(int kmerSizeNew, uint32_t seed, bool canonicalNew)
+	:
+	kmerSize(kmerSizeNew),
+	canonical(canonicalNew),
+	seedMix(seed * 0x9e3779b97f4a7c15LLU),
+	forward(0),
+	reverse(0),
+	valid(0)
+{
+}
@@ -0,0 +1,97 @@
+// Copyright © 2015, Battelle National Biodefense Institute (BNBI);
+// all rights reserved. Authored by: Brian Ondov, Todd Treangen,
+// Sergey Koren, and Adam Phillippy
+//
+// See the LICENSE.txt file included with this software for license information.
+
+#ifndef ntHash_h
+#define ntHash_h
+
+#include <inttypes.h>
+
+// ntHash (Mohamadi et al., Bioinformatics 2016), a rolling hash for DNA
+// k-mers. Each base updates the forward and reverse complement hashes in O(1),
+// and their sum, which is the same for either strand, gives the canonical
+// hash. Only uppercase ACGT is valid; other characters restart the k-mer.
+//
+class NtHash
+{
+public:
+
+    NtHash(int kmerSizeNew, uint32_t seed, bool canonicalNew);
+    
+    // Adds seq[i] to the window (dropping seq[i - k]) and returns true if the
+    // k bases ending at i are all valid, in which case hash() is theirs.
+    //
+    bool roll(const char * seq, uint64_t i);
+    
+    uint64_t hash() const;
+
+private:
+
+    static uint64_t rol(uint64_t x, int r) {return r == 0 ? x : (x << r) | (x >> (64 - r));}
+    static uint64_t ror(uint64_t x, int r) {return r == 0 ? x : (x >> r) | (x << (64 - r));}
+    
+    int kmerSize;
+    bool canonical;
+    uint64_t seedMix;
+    
+    uint64_t forward;
+    uint64_t reverse;
+    int valid; // length of current run of valid bases (up to k)
+};
+
+// per-base seeds from the ntHash paper, indexed by character; 0 if invalid
+//
+extern const uint64_t ntHashSeeds[256];
+extern const uint64_t ntHashSeedsComplement[256];
+
+inline bool NtHash::roll(const char * seq, uint64_t i)
+{
+    uint64_t seedIn = ntHashSeeds[(unsigned char)seq[i]];
+    
+    if ( seedIn == 0 )
+    {
+        valid = 0;
+        forward = 0;
+        reverse = 0;
+        return false;
+    }
+    
+    uint64_t seedInComplement = ntHashSeedsComplement[(unsigned char)seq[i]];
+    
+    forward = rol(forward, 1) ^ seedIn;
+    reverse = ror(reverse, 1) ^ rol(seedInComplement, kmerSize - 1);
+    
+    if ( valid == kmerSize )
+    {
+        unsigned char out = seq[i - kmerSize];
+        
+        forward ^= rol(ntHashSeeds[out], kmerSize);
+        reverse ^= ror(ntHashSeedsComplement[out], 1);
+        
+        return true;
+    }
+    
+    valid++;
+    
+    return valid == kmerSize;
+}
+
+inline uint64_t NtHash::hash() const
+{
+    // finalize as MurmurHash3 does, so the seed and the sum of the strands are
+    // well mixed
+    
+    uint64_t h = (canonical ? forward + reverse : forward) ^ seedMix;
+    
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdLLU;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53LLU;
+    h ^= h >> 33;
+    
+    return h;
+}
+
+#endif
@@ -19,6 +19,7 @@ int sketchParameterSetup(Sketch::Parameters & parameters, const Command & comman
     parameters.concatenated = ! command.getOption("individual").active;
     parameters.noncanonical = command.getOption("noncanonical").active;
     parameters.seed = command.getOption("seed").getArgumentAsNumber();
+    parameters.hashFunction = command.getOption("rolling").active ? hashFunctionNtHash : hashFunctionMurmur3;
     parameters.reads = command.getOption("reads").active;
     parameters.minCov = command.getOption("minCov").getArgumentAsNumber();
     parameters.targetCov = command.getOption("targetCov").getArgumentAsNumber();
@@ -76,6 +77,21 @@ int sketchParameterSetup(Sketch::Parameters & parameters, const Command & comman
         return 1;
     }
     
+    if ( parameters.hashFunction == hashFunctionNtHash )
+    {
+    	if ( command.getOption("protein").active || command.getOption("alphabet").active )
+    	{
+			cerr << "ERROR: The option " << command.getOption("rolling").identifier << " only supports nucleotide sketches and cannot be used with " << command.getOption("protein").identifier << " or " << command.getOption("alphabet").identifier << "." << endl;
+			return 1;
+    	}
+    	
+    	if ( parameters.windowed )
+    	{
+			cerr << "ERROR: The option " << command.getOption("rolling").identifier << " cannot be used with " << command.getOption("windowed").identifier << "." << endl;
+			return 1;
+    	}
+    }
+    
     if ( command.getOption("protein").active )
     {
     	parameters.noncanonical = true;